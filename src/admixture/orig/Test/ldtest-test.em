@@ -0,0 +1,3624 @@
+2-LOCUS LD TESTS
+================
+
+TOTAL SAMPLE  (N = 257)
+
+   MARKERS: rs140864 tsc1291477
+   D' = 1
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   D     A      0.000000 -0.008603  4.914223  0.026636
+   D     G      0.015936  0.008603  4.914223  0.026636
+   I     A      0.539841  0.008603  4.914223  0.026636
+   I     G      0.444223 -0.008603  4.914223  0.026636
+
+   MARKERS: tsc1291477 tsc0058017
+   D' = 0.69819
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.021392 -0.049486 22.244993  0.000002
+   A     G      0.516010  0.049486 22.244993  0.000002
+   G     A      0.110498  0.049486 22.244993  0.000002
+   G     G      0.352100 -0.049486 22.244993  0.000002
+
+   MARKERS: tsc0058017 tsc0268195
+   D' = 0.803583
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     G      0.003774 -0.015439  4.341839  0.037187
+   A     T      0.128116  0.015439  4.341839  0.037187
+   G     G      0.141896  0.015439  4.341839  0.037187
+   G     T      0.726215 -0.015439  4.341839  0.037187
+
+   MARKERS: tsc0268195 rs2814778
+   D' = 0.248869
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     A      0.112530  0.009391  0.936344  0.333220
+   G     G      0.028343 -0.009391  0.936344  0.333220
+   T     A      0.619613 -0.009391  0.936344  0.333220
+   T     G      0.239514  0.009391  0.936344  0.333220
+
+   MARKERS: rs2814778 tsc0053865
+   D' = 0.0831063
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.641484  0.008408  0.791552  0.373631
+   A     T      0.092768 -0.008408  0.791552  0.373631
+   G     A      0.220721 -0.008408  0.791552  0.373631
+   G     T      0.045027  0.008408  0.791552  0.373631
+
+   MARKERS: tsc0053865 tsc0057526
+   D' = 0.224589
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.169251 -0.023635  7.040477  0.007969
+   A     C      0.695291  0.023635  7.040477  0.007969
+   T     A      0.053857  0.023635  7.040477  0.007969
+   T     C      0.081601 -0.023635  7.040477  0.007969
+
+   MARKERS: tsc0057526 rs6003
+   D' = 0.39638
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.122998 -0.058442 32.978760  0.000000
+   A     G      0.101002  0.058442 32.978760  0.000000
+   C     A      0.687002  0.058442 32.978760  0.000000
+   C     G      0.088998 -0.058442 32.978760  0.000000
+
+   MARKERS: rs6003 rs2065160
+   D' = 0.527776
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.014724 -0.016457 12.398748  0.000430
+   A     T      0.802545  0.016457 12.398748  0.000430
+   G     C      0.023428  0.016457 12.398748  0.000430
+   G     T      0.159303 -0.016457 12.398748  0.000430
+
+   MARKERS: rs2065160 tsc0755351
+   D' = 0.700209
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.008339 -0.019477 13.457027  0.000244
+   C     G      0.029661  0.019477 13.457027  0.000244
+   T     A      0.723661  0.019477 13.457027  0.000244
+   T     G      0.238339 -0.019477 13.457027  0.000244
+
+   MARKERS: tsc0755351 rs2752
+   D' = 0.349696
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     G      0.414639  0.047995 11.949094  0.000547
+   A     T      0.312987 -0.047995 11.949094  0.000547
+   G     G      0.089252 -0.047995 11.949094  0.000547
+   G     T      0.183122  0.047995 11.949094  0.000547
+
+   MARKERS: rs2752 tsc0376342
+   D' = 0.326984
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     A      0.479788 -0.006312  1.091101  0.296227
+   G     C      0.026072  0.006312  1.091101  0.296227
+   T     A      0.481150  0.006312  1.091101  0.296227
+   T     C      0.012991 -0.006312  1.091101  0.296227
+
+   MARKERS: tsc0376342 rs17203
+   D' = 0.292434
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.715968 -0.002948  0.317337  0.573212
+   A     G      0.243871  0.002948  0.317337  0.573212
+   C     C      0.033028  0.002948  0.317337  0.573212
+   C     G      0.007133 -0.002948  0.317337  0.573212
+
+   MARKERS: rs17203 tsc0075980
+   D' = 0.0574033
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.691879  0.003229  0.204968  0.650741
+   C     T      0.053019 -0.003229  0.204968  0.650741
+   G     A      0.232610 -0.003229  0.204968  0.650741
+   G     T      0.022492  0.003229  0.204968  0.650741
+
+   MARKERS: tsc0075980 tsc0380878
+   D' = 0.0251137
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.607200 -0.000641  0.006757  0.934486
+   A     T      0.318503  0.000641  0.006757  0.934486
+   T     C      0.049426  0.000641  0.006757  0.934486
+   T     T      0.024871 -0.000641  0.006757  0.934486
+
+   MARKERS: tsc0380878 tsc1365914
+   D' = 0.464126
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.078212 -0.067740 30.340509  0.000000
+   C     C      0.584487  0.067740 30.340509  0.000000
+   T     A      0.142027  0.067740 30.340509  0.000000
+   T     C      0.195275 -0.067740 30.340509  0.000000
+
+   MARKERS: tsc1365914 tsc0357650
+   D' = 0.138743
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.066181  0.021302  4.218048  0.039996
+   A     T      0.160010 -0.021302  4.218048  0.039996
+   C     C      0.132232 -0.021302  4.218048  0.039996
+   C     T      0.641578  0.021302  4.218048  0.039996
+
+   MARKERS: tsc0357650 tsc0043383
+   D' = 0.0650579
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.109715  0.006452  0.268681  0.604218
+   C     G      0.092714 -0.006452  0.268681  0.604218
+   T     A      0.400406 -0.006452  0.268681  0.604218
+   T     G      0.397164  0.006452  0.268681  0.604218
+
+   MARKERS: tsc0043383 rs3309
+   D' = 0.128397
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.350357 -0.017435  1.570219  0.210175
+   A     T      0.157643  0.017435  1.570219  0.210175
+   G     A      0.373643  0.017435  1.570219  0.210175
+   G     T      0.118357 -0.017435  1.570219  0.210175
+
+   MARKERS: rs3309 rs3317
+   D' = 0.0486452
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.354935  0.006415  0.212836  0.644553
+   A     G      0.370555 -0.006415  0.212836  0.644553
+   T     A      0.125457 -0.006415  0.212836  0.644553
+   T     G      0.149052  0.006415  0.212836  0.644553
+
+   MARKERS: rs3317 tsc0696884
+   D' = 0.145422
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.089451 -0.015222  1.411450  0.234816
+   A     T      0.392620  0.015222  1.411450  0.234816
+   G     A      0.127680  0.015222  1.411450  0.234816
+   G     T      0.390248 -0.015222  1.411450  0.234816
+
+   MARKERS: tsc0696884 rs3340
+   D' = 0.286576
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.193513  0.009627  1.081766  0.298303
+   A     G      0.023967 -0.009627  1.081766  0.298303
+   T     A      0.652016 -0.009627  1.081766  0.298303
+   T     G      0.130504  0.009627  1.081766  0.298303
+
+   MARKERS: rs3340 rs2763
+   D' = 0.133593
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.135000  0.003198  0.155310  0.693511
+   A     G      0.711311 -0.003198  0.155310  0.693511
+   G     C      0.020738 -0.003198  0.155310  0.693511
+   G     G      0.132951  0.003198  0.155310  0.693511
+
+   MARKERS: rs2763 rs2161
+   D' = 0.0292006
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.059215  0.002851  0.069230  0.792462
+   C     G      0.094785 -0.002851  0.069230  0.792462
+   G     A      0.306785 -0.002851  0.069230  0.792462
+   G     G      0.539215  0.002851  0.069230  0.792462
+
+   MARKERS: rs2161 tsc1612346
+   D' = 0.175505
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.163395  0.038214  7.183411  0.007358
+   A     G      0.201649 -0.038214  7.183411  0.007358
+   G     A      0.179525 -0.038214  7.183411  0.007358
+   G     G      0.455431  0.038214  7.183411  0.007358
+
+   MARKERS: tsc1612346 tsc0800273
+   D' = 0.0067361
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.275422 -0.000875  0.005405  0.941392
+   A     T      0.069173  0.000875  0.005405  0.941392
+   G     C      0.526380  0.000875  0.005405  0.941392
+   G     T      0.129025 -0.000875  0.005405  0.941392
+
+   MARKERS: tsc0800273 tsc0988681
+   D' = 0.161796
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.585521 -0.008368  0.592850  0.441319
+   C     T      0.211667  0.008368  0.592850  0.441319
+   T     C      0.159459  0.008368  0.592850  0.441319
+   T     T      0.043353 -0.008368  0.592850  0.441319
+
+   MARKERS: tsc0988681 rs2695
+   D' = 0.364785
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.200205  0.021705  3.569253  0.058859
+   C     G      0.549795 -0.021705  3.569253  0.058859
+   T     A      0.037795 -0.021705  3.569253  0.058859
+   T     G      0.212205  0.021705  3.569253  0.058859
+
+   MARKERS: rs2695 tsc0927612
+   D' = 0.0512358
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.201428 -0.005477  0.344612  0.557179
+   A     T      0.039388  0.005477  0.344612  0.557179
+   G     C      0.657756  0.005477  0.344612  0.557179
+   G     T      0.101428 -0.005477  0.344612  0.557179
+
+   MARKERS: tsc0927612 tsc0813195
+   D' = 0.0254508
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.202284 -0.002808  0.089776  0.764462
+   C     T      0.652554  0.002808  0.089776  0.764462
+   T     A      0.037635  0.002808  0.089776  0.764462
+   T     T      0.107526 -0.002808  0.089776  0.764462
+
+   MARKERS: tsc0813195 tsc0010190
+   D' = 0.371723
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.146121 -0.052410 25.569636  0.000000
+   A     T      0.097927  0.052410 25.569636  0.000000
+   T     C      0.667371  0.052410 25.569636  0.000000
+   T     T      0.088581 -0.052410 25.569636  0.000000
+
+   MARKERS: tsc0010190 tsc0717625
+   D' = 0.698951
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.042481 -0.098628 116.117110  0.000000
+   C     T      0.774980  0.098628 116.117110  0.000000
+   T     C      0.130138  0.098628 116.117110  0.000000
+   T     T      0.052401 -0.098628 116.117110  0.000000
+
+   MARKERS: tsc0717625 rs594689
+   D' = 0.519181
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.036071 -0.038949 11.166782  0.000833
+   C     G      0.137157  0.038949 11.166782  0.000833
+   T     A      0.397000  0.038949 11.166782  0.000833
+   T     G      0.429772 -0.038949 11.166782  0.000833
+
+   MARKERS: rs594689 rs1042602
+   D' = 0.208489
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.163862  0.035134  6.195731  0.012806
+   A     C      0.269209 -0.035134  6.195731  0.012806
+   G     A      0.133383 -0.035134  6.195731  0.012806
+   G     C      0.433547  0.035134  6.195731  0.012806
+
+   MARKERS: rs1042602 rs1800498
+   D' = 0.301533
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.099027 -0.042750  9.017318  0.002674
+   A     T      0.197416  0.042750  9.017318  0.002674
+   C     C      0.379234  0.042750  9.017318  0.002674
+   C     T      0.324323 -0.042750  9.017318  0.002674
+
+   MARKERS: rs1800498 rs1079598
+   D' = 1
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.168033  0.087115 56.275990  0.000000
+   C     T      0.313525 -0.087115 56.275990  0.000000
+   T     C      0.000000 -0.087115 56.275990  0.000000
+   T     T      0.518443  0.087115 56.275990  0.000000
+
+   MARKERS: rs1079598 tsc0039147
+   D' = 0.0723814
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.127176  0.003028  0.092202  0.761396
+   C     T      0.038808 -0.003028  0.092202  0.761396
+   T     C      0.620775 -0.003028  0.092202  0.761396
+   T     T      0.213241  0.003028  0.092202  0.761396
+
+   MARKERS: tsc0039147 tsc0055196
+   D' = 0.473422
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.072274 -0.064979 40.003575  0.000000
+   C     C      0.685600  0.064979 40.003575  0.000000
+   T     A      0.108828  0.064979 40.003575  0.000000
+   T     C      0.133298 -0.064979 40.003575  0.000000
+
+   MARKERS: tsc0055196 rs1800404
+   D' = 0.495772
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.058052 -0.057078 24.590847  0.000001
+   A     G      0.121700  0.057078 24.590847  0.000001
+   C     A      0.582444  0.057078 24.590847  0.000001
+   C     G      0.237804 -0.057078 24.590847  0.000001
+
+   MARKERS: rs1800404 rs2862
+   D' = 0.0584464
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.168286  0.005460  0.174203  0.676403
+   A     T      0.467131 -0.005460  0.174203  0.676403
+   G     C      0.087964 -0.005460  0.174203  0.676403
+   G     T      0.276619  0.005460  0.174203  0.676403
+
+   MARKERS: rs2862 tsc0055903
+   D' = 0.1069
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.163461 -0.019565  2.514745  0.112786
+   C     T      0.094804  0.019565  2.514745  0.112786
+   T     C      0.545217  0.019565  2.514745  0.112786
+   T     T      0.196519 -0.019565  2.514745  0.112786
+
+   MARKERS: tsc0055903 tsc0473031
+   D' = 0.484144
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.525872  0.085213 38.347802  0.000000
+   C     T      0.188711 -0.085213 38.347802  0.000000
+   T     C      0.090794 -0.085213 38.347802  0.000000
+   T     T      0.194622  0.085213 38.347802  0.000000
+
+   MARKERS: tsc0473031 rs4646
+   D' = 0.0379328
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     G      0.452190  0.006405  0.224567  0.635582
+   C     T      0.162435 -0.006405  0.224567  0.635582
+   T     G      0.273107 -0.006405  0.224567  0.635582
+   T     T      0.112269  0.006405  0.224567  0.635582
+
+   MARKERS: rs4646 tsc1472708
+   D' = 0.0466639
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     C      0.169071 -0.008276  0.482616  0.487240
+   G     G      0.560340  0.008276  0.482616  0.487240
+   T     C      0.074066  0.008276  0.482616  0.487240
+   T     G      0.196522 -0.008276  0.482616  0.487240
+
+   MARKERS: tsc1472708 rs2891
+   D' = 0.472735
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.187437  0.048804 13.575758  0.000229
+   C     G      0.054433 -0.048804 13.575758  0.000229
+   G     A      0.385734 -0.048804 13.575758  0.000229
+   G     G      0.372396  0.048804 13.575758  0.000229
+
+   MARKERS: rs2891 rs2816
+   D' = 0.0960205
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.373419  0.020971  1.948644  0.162733
+   A     T      0.197431 -0.020971  1.948644  0.162733
+   G     C      0.243990 -0.020971  1.948644  0.162733
+   G     T      0.185160  0.020971  1.948644  0.162733
+
+   MARKERS: rs2816 tsc0051129
+   D' = 0.548934
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.216146  0.055802 17.529050  0.000028
+   C     G      0.395854 -0.055802 17.529050  0.000028
+   T     C      0.045854 -0.055802 17.529050  0.000028
+   T     G      0.342146  0.055802 17.529050  0.000028
+
+   MARKERS: tsc0051129 tsc0041150
+   D' = 0.185175
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.202002  0.010150  0.781775  0.376599
+   C     G      0.044664 -0.010150  0.781775  0.376599
+   G     A      0.575776 -0.010150  0.781775  0.376599
+   G     G      0.177558  0.010150  0.781775  0.376599
+
+   MARKERS: tsc0041150 tsc0549661
+   D' = 0.103116
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.232418  0.006917  0.341233  0.559118
+   A     T      0.538325 -0.006917  0.341233  0.559118
+   G     C      0.060159 -0.006917  0.341233  0.559118
+   G     T      0.169099  0.006917  0.341233  0.559118
+
+   MARKERS: tsc0549661 rs4884
+   D' = 0.831937
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.043147 -0.164279 168.514241  0.000000
+   C     T      0.243706  0.164279 168.514241  0.000000
+   T     C      0.679961  0.164279 168.514241  0.000000
+   T     T      0.033187 -0.164279 168.514241  0.000000
+
+   MARKERS: rs4884 tsc0042022
+   D' = 0.208866
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.148617  0.011051  1.013871  0.313977
+   C     G      0.573605 -0.011051  1.013871  0.313977
+   T     A      0.041859 -0.011051  1.013871  0.313977
+   T     G      0.235919  0.011051  1.013871  0.313977
+
+UNAFFECTED  (N = 127)
+
+   MARKERS: rs140864 tsc1291477
+   D' = 1
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   D     A      0.000000 -0.010236  2.741092  0.097798
+   D     G      0.019841  0.010236  2.741092  0.097798
+   I     A      0.515873  0.010236  2.741092  0.097798
+   I     G      0.464286 -0.010236  2.741092  0.097798
+
+   MARKERS: tsc1291477 tsc0058017
+   D' = 0.817958
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.013244 -0.059508 15.064416  0.000104
+   A     G      0.510566  0.059508 15.064416  0.000104
+   G     A      0.125645  0.059508 15.064416  0.000104
+   G     G      0.350545 -0.059508 15.064416  0.000104
+
+   MARKERS: tsc0058017 tsc0268195
+   D' = 1
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     G      0.000000 -0.018480  3.186602  0.074244
+   A     T      0.140000  0.018480  3.186602  0.074244
+   G     G      0.132000  0.018480  3.186602  0.074244
+   G     T      0.728000 -0.018480  3.186602  0.074244
+
+   MARKERS: tsc0268195 rs2814778
+   D' = 0.377195
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     A      0.099399  0.013063  0.936496  0.333181
+   G     G      0.021569 -0.013063  0.936496  0.333181
+   T     A      0.614311 -0.013063  0.936496  0.333181
+   T     G      0.264721  0.013063  0.936496  0.333181
+
+   MARKERS: rs2814778 tsc0053865
+   D' = 0.175644
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.635728  0.017104  1.575814  0.209365
+   A     T      0.080272 -0.017104  1.575814  0.209365
+   G     A      0.228272 -0.017104  1.575814  0.209365
+   G     T      0.055728  0.017104  1.575814  0.209365
+
+   MARKERS: tsc0053865 tsc0057526
+   D' = 0.150552
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.200320 -0.014944  1.311759  0.252076
+   A     C      0.667680  0.014944  1.311759  0.252076
+   T     A      0.047680  0.014944  1.311759  0.252076
+   T     C      0.084320 -0.014944  1.311759  0.252076
+
+   MARKERS: tsc0057526 rs6003
+   D' = 0.402153
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.129110 -0.065322 16.907392  0.000039
+   A     G      0.118890  0.065322 16.907392  0.000039
+   C     A      0.654890  0.065322 16.907392  0.000039
+   C     G      0.097110 -0.065322 16.907392  0.000039
+
+   MARKERS: rs6003 rs2065160
+   D' = 0.524485
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.012195 -0.013451  4.249494  0.039262
+   A     T      0.776423  0.013451  4.249494  0.039262
+   G     C      0.020325  0.013451  4.249494  0.039262
+   G     T      0.191057 -0.013451  4.249494  0.039262
+
+   MARKERS: rs2065160 tsc0755351
+   D' = 0.658333
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.008130 -0.015665  5.006539  0.025252
+   C     G      0.024390  0.015665  5.006539  0.025252
+   T     A      0.723577  0.015665  5.006539  0.025252
+   T     G      0.243902 -0.015665  5.006539  0.025252
+
+   MARKERS: tsc0755351 rs2752
+   D' = 0.423822
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     G      0.398494  0.054393  7.619530  0.005774
+   A     T      0.329852 -0.054393  7.619530  0.005774
+   G     G      0.073947 -0.054393  7.619530  0.005774
+   G     T      0.197707  0.054393  7.619530  0.005774
+
+   MARKERS: rs2752 tsc0376342
+   D' = 0.386628
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     A      0.451137 -0.006424  0.689314  0.406398
+   G     C      0.021304  0.006424  0.689314  0.406398
+   T     A      0.517367  0.006424  0.689314  0.406398
+   T     C      0.010192 -0.006424  0.689314  0.406398
+
+   MARKERS: tsc0376342 rs17203
+   D' = 0.323494
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.718751 -0.002695  0.159531  0.689589
+   A     G      0.248462  0.002695  0.159531  0.689589
+   C     C      0.027151  0.002695  0.159531  0.689589
+   C     G      0.005636 -0.002695  0.159531  0.689589
+
+   MARKERS: rs17203 tsc0075980
+   D' = 0.121449
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.700942  0.005630  0.376533  0.539465
+   C     T      0.040725 -0.005630  0.376533  0.539465
+   G     A      0.236558 -0.005630  0.376533  0.539465
+   G     T      0.021775  0.005630  0.376533  0.539465
+
+   MARKERS: tsc0075980 tsc0380878
+   D' = 0.253621
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.620806  0.010058  1.009520  0.315018
+   A     T      0.318218 -0.010058  1.009520  0.315018
+   T     C      0.029601 -0.010058  1.009520  0.315018
+   T     T      0.031375  0.010058  1.009520  0.315018
+
+   MARKERS: tsc0380878 tsc1365914
+   D' = 0.428232
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.085714 -0.064197 13.017178  0.000309
+   C     C      0.572822  0.064197 13.017178  0.000309
+   T     A      0.141928  0.064197 13.017178  0.000309
+   T     C      0.199535 -0.064197 13.017178  0.000309
+
+   MARKERS: tsc1365914 tsc0357650
+   D' = 0.229043
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.082530  0.035378  5.526671  0.018729
+   A     T      0.151341 -0.035378  5.526671  0.018729
+   C     C      0.119083 -0.035378  5.526671  0.018729
+   C     T      0.647046  0.035378  5.526671  0.018729
+
+   MARKERS: tsc0357650 tsc0043383
+   D' = 0.170419
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.125849  0.016392  0.850047  0.356539
+   C     G      0.079796 -0.016392  0.850047  0.356539
+   T     A      0.406409 -0.016392  0.850047  0.356539
+   T     G      0.387945  0.016392  0.850047  0.356539
+
+   MARKERS: tsc0043383 rs3309
+   D' = 0.0804648
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.373173 -0.010603  0.285076  0.593393
+   A     T      0.162827  0.010603  0.285076  0.593393
+   G     A      0.342827  0.010603  0.285076  0.593393
+   G     T      0.121173 -0.010603  0.285076  0.593393
+
+   MARKERS: rs3309 rs3317
+   D' = 0.130194
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.366513  0.017623  0.784197  0.375861
+   A     G      0.353959 -0.017623  0.784197  0.375861
+   T     A      0.117738 -0.017623  0.784197  0.375861
+   T     G      0.161789  0.017623  0.784197  0.375861
+
+   MARKERS: rs3317 tsc0696884
+   D' = 0.277805
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.079084 -0.030421  2.688642  0.101066
+   A     T      0.405043  0.030421  2.688642  0.101066
+   G     A      0.147107  0.030421  2.688642  0.101066
+   G     T      0.368766 -0.030421  2.688642  0.101066
+
+   MARKERS: tsc0696884 rs3340
+   D' = 0.730235
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.219612  0.026788  3.902963  0.048201
+   A     G      0.009896 -0.026788  3.902963  0.048201
+   T     A      0.620552 -0.026788  3.902963  0.048201
+   T     G      0.149940  0.026788  3.902963  0.048201
+
+   MARKERS: rs3340 rs2763
+   D' = 0.407031
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.118718  0.008532  0.625168  0.429133
+   A     G      0.721446 -0.008532  0.625168  0.429133
+   G     C      0.012430 -0.008532  0.625168  0.429133
+   G     G      0.147406  0.008532  0.625168  0.429133
+
+   MARKERS: rs2763 rs2161
+   D' = 0.0102794
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.048442  0.000826  0.003345  0.953883
+   C     G      0.079558 -0.000826  0.003345  0.953883
+   G     A      0.323558 -0.000826  0.003345  0.953883
+   G     G      0.548442  0.000826  0.003345  0.953883
+
+   MARKERS: rs2161 tsc1612346
+   D' = 0.154796
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.159725  0.034339  2.837374  0.092095
+   A     G      0.201386 -0.034339  2.837374  0.092095
+   G     A      0.187497 -0.034339  2.837374  0.092095
+   G     G      0.451392  0.034339  2.837374  0.092095
+
+   MARKERS: tsc1612346 tsc0800273
+   D' = 0.114077
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.261040 -0.015831  0.807788  0.368775
+   A     T      0.091341  0.015831  0.807788  0.368775
+   G     C      0.524675  0.015831  0.807788  0.368775
+   G     T      0.122944 -0.015831  0.807788  0.368775
+
+   MARKERS: tsc0800273 tsc0988681
+   D' = 0.230273
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.561407 -0.013385  0.694975  0.404477
+   C     T      0.213593  0.013385  0.694975  0.404477
+   T     C      0.180260  0.013385  0.694975  0.404477
+   T     T      0.044740 -0.013385  0.694975  0.404477
+
+   MARKERS: tsc0988681 rs2695
+   D' = 0.338889
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.188155  0.019097  1.421128  0.233218
+   C     G      0.561845 -0.019097  1.421128  0.233218
+   T     A      0.037255 -0.019097  1.421128  0.233218
+   T     G      0.212745  0.019097  1.421128  0.233218
+
+   MARKERS: rs2695 tsc0927612
+   D' = 0.280146
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.157571 -0.032375  5.863379  0.015459
+   A     T      0.065570  0.032375  5.863379  0.015459
+   G     C      0.693669  0.032375  5.863379  0.015459
+   G     T      0.083191 -0.032375  5.863379  0.015459
+
+   MARKERS: tsc0927612 tsc0813195
+   D' = 0.136851
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.187986 -0.016159  1.368782  0.242021
+   C     T      0.656276  0.016159  1.368782  0.242021
+   T     A      0.053817  0.016159  1.368782  0.242021
+   T     T      0.101921 -0.016159  1.368782  0.242021
+
+   MARKERS: tsc0813195 tsc0010190
+   D' = 0.421237
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.140466 -0.061147 16.500721  0.000049
+   A     T      0.109534  0.061147 16.500721  0.000049
+   T     C      0.665986  0.061147 16.500721  0.000049
+   T     T      0.084014 -0.061147 16.500721  0.000049
+
+   MARKERS: tsc0010190 tsc0717625
+   D' = 0.724892
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.037045 -0.097612 56.160037  0.000000
+   C     T      0.777471  0.097612 56.160037  0.000000
+   T     C      0.128277  0.097612 56.160037  0.000000
+   T     T      0.057207 -0.097612 56.160037  0.000000
+
+   MARKERS: tsc0717625 rs594689
+   D' = 0.546383
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.034446 -0.041490  6.363967  0.011646
+   C     G      0.133554  0.041490  6.363967  0.011646
+   T     A      0.417554  0.041490  6.363967  0.011646
+   T     G      0.414446 -0.041490  6.363967  0.011646
+
+   MARKERS: rs594689 rs1042602
+   D' = 0.280505
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.203439  0.052188  6.244820  0.012456
+   A     C      0.244974 -0.052188  6.244820  0.012456
+   G     A      0.133863 -0.052188  6.244820  0.012456
+   G     C      0.417724  0.052188  6.244820  0.012456
+
+   MARKERS: rs1042602 rs1800498
+   D' = 0.348475
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.106761 -0.057102  7.408303  0.006492
+   A     T      0.234509  0.057102  7.408303  0.006492
+   C     C      0.373397  0.057102  7.408303  0.006492
+   C     T      0.285333 -0.057102  7.408303  0.006492
+
+   MARKERS: rs1800498 rs1079598
+   D' = 1
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.195833  0.098733 31.693929  0.000000
+   C     T      0.300000 -0.098733 31.693929  0.000000
+   T     C      0.000000 -0.098733 31.693929  0.000000
+   T     T      0.504167  0.098733 31.693929  0.000000
+
+   MARKERS: rs1079598 tsc0039147
+   D' = 0.0223358
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.137308 -0.003137  0.041122  0.839303
+   C     T      0.056907  0.003137  0.041122  0.839303
+   T     C      0.585833  0.003137  0.041122  0.839303
+   T     T      0.219952 -0.003137  0.041122  0.839303
+
+   MARKERS: tsc0039147 tsc0055196
+   D' = 0.501575
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.070073 -0.070516 21.088944  0.000004
+   C     C      0.668022  0.070516 21.088944  0.000004
+   T     A      0.120403  0.070516 21.088944  0.000004
+   T     C      0.141502 -0.070516 21.088944  0.000004
+
+   MARKERS: tsc0055196 rs1800404
+   D' = 0.674958
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.038891 -0.080758 22.349874  0.000002
+   A     G      0.159385  0.080758 22.349874  0.000002
+   C     A      0.564557  0.080758 22.349874  0.000002
+   C     G      0.237167 -0.080758 22.349874  0.000002
+
+   MARKERS: rs1800404 rs2862
+   D' = 0.074183
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.120215 -0.009632  0.280457  0.596402
+   A     T      0.471890  0.009632  0.280457  0.596402
+   G     C      0.099083  0.009632  0.280457  0.596402
+   G     T      0.308812 -0.009632  0.280457  0.596402
+
+   MARKERS: rs2862 tsc0055903
+   D' = 0.188451
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.128855 -0.029922  3.058699  0.080306
+   C     T      0.101914  0.029922  3.058699  0.080306
+   T     C      0.559179  0.029922  3.058699  0.080306
+   T     T      0.210052 -0.029922  3.058699  0.080306
+
+   MARKERS: tsc0055903 tsc0473031
+   D' = 0.514791
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.519875  0.096798 23.480018  0.000001
+   C     T      0.172433 -0.096798 23.480018  0.000001
+   T     C      0.091236 -0.096798 23.480018  0.000001
+   T     T      0.216456  0.096798 23.480018  0.000001
+
+   MARKERS: tsc0473031 rs4646
+   D' = 0.0290252
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     G      0.433256  0.005224  0.070423  0.790722
+   C     T      0.174744 -0.005224  0.070423  0.790722
+   T     G      0.270744 -0.005224  0.070423  0.790722
+   T     T      0.121256  0.005224  0.070423  0.790722
+
+   MARKERS: rs4646 tsc1472708
+   D' = 0.0529601
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     C      0.168194  0.003584  0.044308  0.833282
+   G     G      0.540467 -0.003584  0.044308  0.833282
+   T     C      0.064089 -0.003584  0.044308  0.833282
+   T     G      0.227249  0.003584  0.044308  0.833282
+
+   MARKERS: tsc1472708 rs2891
+   D' = 0.594437
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.190979  0.056472  9.362317  0.002215
+   C     G      0.038529 -0.056472  9.362317  0.002215
+   G     A      0.395086 -0.056472  9.362317  0.002215
+   G     G      0.375405  0.056472  9.362317  0.002215
+
+   MARKERS: rs2891 rs2816
+   D' = 0.150224
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.390122  0.034639  2.640983  0.104139
+   A     T      0.195944 -0.034639  2.640983  0.104139
+   G     C      0.216436 -0.034639  2.640983  0.104139
+   G     T      0.197499  0.034639  2.640983  0.104139
+
+   MARKERS: rs2816 tsc0051129
+   D' = 0.568091
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.214469  0.057341  9.169565  0.002461
+   C     G      0.394402 -0.057341  9.169565  0.002461
+   T     C      0.043595 -0.057341  9.169565  0.002461
+   T     G      0.347534  0.057341  9.169565  0.002461
+
+   MARKERS: tsc0051129 tsc0041150
+   D' = 0.127708
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.198911  0.008122  0.227028  0.633736
+   C     G      0.055475 -0.008122  0.227028  0.633736
+   G     A      0.551089 -0.008122  0.227028  0.633736
+   G     G      0.194525  0.008122  0.227028  0.633736
+
+   MARKERS: tsc0041150 tsc0549661
+   D' = 0.107174
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.240789  0.008867  0.240726  0.623682
+   A     T      0.496280 -0.008867  0.240726  0.623682
+   G     C      0.073866 -0.008867  0.240726  0.623682
+   G     T      0.189065  0.008867  0.240726  0.623682
+
+   MARKERS: tsc0549661 rs4884
+   D' = 0.805313
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.041495 -0.171641 81.346044  0.000000
+   C     T      0.266505  0.171641 81.346044  0.000000
+   T     C      0.650505  0.171641 81.346044  0.000000
+   T     T      0.041495 -0.171641 81.346044  0.000000
+
+   MARKERS: rs4884 tsc0042022
+   D' = 0.42493
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.150048  0.024009  2.309682  0.128570
+   C     G      0.540428 -0.024009  2.309682  0.128570
+   T     A      0.032492 -0.024009  2.309682  0.128570
+   T     G      0.277032  0.024009  2.309682  0.128570
+
+AFFECTED  (N = 130)
+
+   MARKERS: rs140864 tsc1291477
+   D' = 1
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   D     A      0.000000 -0.006768  2.062227  0.150989
+   D     G      0.012000  0.006768  2.062227  0.150989
+   I     A      0.564000  0.006768  2.062227  0.150989
+   I     G      0.424000 -0.006768  2.062227  0.150989
+
+   MARKERS: tsc1291477 tsc0058017
+   D' = 0.542583
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.031492 -0.037356  6.793127  0.009151
+   A     G      0.519289  0.037356  6.793127  0.009151
+   G     A      0.093508  0.037356  6.793127  0.009151
+   G     G      0.355711 -0.037356  6.793127  0.009151
+
+   MARKERS: tsc0058017 tsc0268195
+   D' = 0.617175
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     G      0.007546 -0.012165  1.333545  0.248175
+   A     T      0.116485  0.012165  1.333545  0.248175
+   G     G      0.151369  0.012165  1.333545  0.248175
+   G     T      0.724600 -0.012165  1.333545  0.248175
+
+   MARKERS: tsc0268195 rs2814778
+   D' = 0.130904
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     A      0.125358  0.005241  0.143246  0.705075
+   G     G      0.034798 -0.005241  0.143246  0.705075
+   T     A      0.624642 -0.005241  0.143246  0.705075
+   T     G      0.215202  0.005241  0.143246  0.705075
+
+   MARKERS: rs2814778 tsc0053865
+   D' = 0.114928
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.643038 -0.003978  0.092457  0.761077
+   A     T      0.108900  0.003978  0.092457  0.761077
+   G     A      0.217427  0.003978  0.092457  0.761077
+   G     T      0.030635 -0.003978  0.092457  0.761077
+
+   MARKERS: tsc0053865 tsc0057526
+   D' = 0.2863
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.138981 -0.031874  6.961553  0.008328
+   A     C      0.722130  0.031874  6.961553  0.008328
+   T     A      0.059432  0.031874  6.961553  0.008328
+   T     C      0.079457 -0.031874  6.961553  0.008328
+
+   MARKERS: tsc0057526 rs6003
+   D' = 0.383215
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.116922 -0.050278 15.459213  0.000084
+   A     G      0.083078  0.050278 15.459213  0.000084
+   C     A      0.719078  0.050278 15.459213  0.000084
+   C     G      0.080922 -0.050278 15.459213  0.000084
+
+   MARKERS: rs6003 rs2065160
+   D' = 0.540984
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.016936 -0.019960  9.351937  0.002227
+   A     T      0.828303  0.019960  9.351937  0.002227
+   G     C      0.026715  0.019960  9.351937  0.002227
+   G     T      0.128047 -0.019960  9.351937  0.002227
+
+   MARKERS: rs2065160 tsc0755351
+   D' = 0.733766
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.008443 -0.023270  8.558520  0.003439
+   C     G      0.034864  0.023270  8.558520  0.003439
+   T     A      0.723840  0.023270  8.558520  0.003439
+   T     G      0.232853 -0.023270  8.558520  0.003439
+
+   MARKERS: tsc0755351 rs2752
+   D' = 0.287051
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     G      0.430531  0.041907  4.622580  0.031554
+   A     T      0.296392 -0.041907  4.622580  0.031554
+   G     G      0.104084 -0.041907  4.622580  0.031554
+   G     T      0.168993  0.041907  4.622580  0.031554
+
+   MARKERS: rs2752 tsc0376342
+   D' = 0.0304414
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     A      0.513048 -0.000653  0.005025  0.943488
+   G     C      0.025712  0.000653  0.005025  0.943488
+   T     A      0.440440  0.000653  0.005025  0.943488
+   T     C      0.020800 -0.000653  0.005025  0.943488
+
+   MARKERS: tsc0376342 rs17203
+   D' = 0.259373
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.713403 -0.003039  0.145957  0.702429
+   A     G      0.239353  0.003039  0.145957  0.702429
+   C     C      0.038565  0.003039  0.145957  0.702429
+   C     G      0.008679 -0.003039  0.145957  0.702429
+
+   MARKERS: rs17203 tsc0075980
+   D' = 0.0148285
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.681847 -0.000329  0.000920  0.975802
+   C     T      0.066153  0.000329  0.000920  0.975802
+   G     A      0.230153  0.000329  0.000920  0.975802
+   G     T      0.021847 -0.000329  0.000920  0.975802
+
+   MARKERS: tsc0075980 tsc0380878
+   D' = 0.250303
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.597473 -0.007371  0.385926  0.534449
+   A     T      0.315225  0.007371  0.385926  0.534449
+   T     C      0.065225  0.007371  0.385926  0.534449
+   T     T      0.022076 -0.007371  0.385926  0.534449
+
+   MARKERS: tsc0380878 tsc1365914
+   D' = 0.498438
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.071281 -0.070837 17.370778  0.000031
+   C     C      0.595385  0.070837 17.370778  0.000031
+   T     A      0.141897  0.070837 17.370778  0.000031
+   T     C      0.191436 -0.070837 17.370778  0.000031
+
+   MARKERS: tsc1365914 tsc0357650
+   D' = 0.0305854
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.047392  0.004667  0.106609  0.744038
+   A     T      0.171358 -0.004667  0.106609  0.744038
+   C     C      0.147921 -0.004667  0.106609  0.744038
+   C     T      0.633329  0.004667  0.106609  0.744038
+
+   MARKERS: tsc0357650 tsc0043383
+   D' = 0.069792
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.090383 -0.006781  0.152395  0.696257
+   C     G      0.108804  0.006781  0.152395  0.696257
+   T     A      0.397422  0.006781  0.152395  0.696257
+   T     G      0.403391 -0.006781  0.152395  0.696257
+
+   MARKERS: tsc0043383 rs3309
+   D' = 0.165976
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.328230 -0.023130  1.416323  0.234010
+   A     T      0.151770  0.023130  1.416323  0.234010
+   G     A      0.403770  0.023130  1.416323  0.234010
+   G     T      0.116230 -0.023130  1.416323  0.234010
+
+   MARKERS: rs3309 rs3317
+   D' = 0.0314533
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.343676 -0.004438  0.052160  0.819347
+   A     G      0.386792  0.004438  0.052160  0.819347
+   T     A      0.132886  0.004438  0.052160  0.819347
+   T     G      0.136645 -0.004438  0.052160  0.819347
+
+   MARKERS: rs3317 tsc0696884
+   D' = 0.00224291
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.100083  0.000243  0.000188  0.989049
+   A     T      0.379917 -0.000243  0.000188  0.989049
+   G     A      0.107917 -0.000243  0.000188  0.989049
+   G     T      0.412083  0.000243  0.000188  0.989049
+
+   MARKERS: tsc0696884 rs3340
+   D' = 0.116457
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.161163 -0.013802  1.195485  0.274226
+   A     G      0.044483  0.013802  1.195485  0.274226
+   T     A      0.689644  0.013802  1.195485  0.274226
+   T     G      0.104711 -0.013802  1.195485  0.274226
+
+   MARKERS: rs3340 rs2763
+   D' = 0.0452383
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.148251 -0.005471  0.207204  0.648968
+   A     G      0.704208  0.005471  0.207204  0.648968
+   G     C      0.032077  0.005471  0.207204  0.648968
+   G     G      0.115464 -0.005471  0.207204  0.648968
+
+   MARKERS: rs2763 rs2161
+   D' = 0.0426117
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.069709  0.004909  0.091945  0.761718
+   C     G      0.110291 -0.004909  0.091945  0.761718
+   G     A      0.290291 -0.004909  0.091945  0.761718
+   G     G      0.529709  0.004909  0.091945  0.761718
+
+   MARKERS: rs2161 tsc1612346
+   D' = 0.194228
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.166533  0.041569  4.343036  0.037161
+   A     G      0.202111 -0.041569  4.343036  0.037161
+   G     A      0.172450 -0.041569  4.343036  0.037161
+   G     G      0.458905  0.041569  4.343036  0.037161
+
+   MARKERS: tsc1612346 tsc0800273
+   D' = 0.260115
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.291705  0.016137  1.014085  0.313926
+   A     T      0.045902 -0.016137  1.014085  0.313926
+   G     C      0.524534 -0.016137  1.014085  0.313926
+   G     T      0.137859  0.016137  1.014085  0.313926
+
+   MARKERS: tsc0800273 tsc0988681
+   D' = 0.060737
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.609000 -0.002788  0.036162  0.849181
+   C     T      0.208830  0.002788  0.036162  0.849181
+   T     C      0.139062  0.002788  0.036162  0.849181
+   T     T      0.043108 -0.002788  0.036162  0.849181
+
+   MARKERS: tsc0988681 rs2695
+   D' = 0.389597
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.211850  0.024350  2.192467  0.138687
+   C     G      0.538150 -0.024350  2.192467  0.138687
+   T     A      0.038150 -0.024350  2.192467  0.138687
+   T     G      0.211850  0.024350  2.192467  0.138687
+
+   MARKERS: rs2695 tsc0927612
+   D' = 0.507591
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.241156  0.017430  1.804757  0.179138
+   A     T      0.016909 -0.017430  1.804757  0.179138
+   G     C      0.625780 -0.017430  1.804757  0.179138
+   G     T      0.116156  0.017430  1.804757  0.179138
+
+   MARKERS: tsc0927612 tsc0813195
+   D' = 0.482364
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.221467  0.015495  1.489280  0.222328
+   C     T      0.643613 -0.015495  1.489280  0.222328
+   T     A      0.016629 -0.015495  1.489280  0.222328
+   T     T      0.118292  0.015495  1.489280  0.222328
+
+   MARKERS: tsc0813195 tsc0010190
+   D' = 0.31532
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.152307 -0.043158  9.148019  0.002490
+   A     T      0.085974  0.043158  9.148019  0.002490
+   T     C      0.668006  0.043158  9.148019  0.002490
+   T     T      0.093713 -0.043158  9.148019  0.002490
+
+   MARKERS: tsc0010190 tsc0717625
+   D' = 0.676195
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.047729 -0.099671 60.167403  0.000000
+   C     T      0.772584  0.099671 60.167403  0.000000
+   T     C      0.131959  0.099671 60.167403  0.000000
+   T     T      0.047729 -0.099671 60.167403  0.000000
+
+   MARKERS: tsc0717625 rs594689
+   D' = 0.477941
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.038603 -0.035341  4.593620  0.032091
+   C     G      0.139691  0.035341  4.593620  0.032091
+   T     A      0.376126  0.035341  4.593620  0.032091
+   T     G      0.445580 -0.035341  4.593620  0.032091
+
+   MARKERS: rs594689 rs1042602
+   D' = 0.0880407
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.120969  0.013211  0.491008  0.483478
+   A     C      0.297000 -0.013211  0.491008  0.483478
+   G     A      0.136844 -0.013211  0.491008  0.483478
+   G     C      0.445187  0.013211  0.491008  0.483478
+
+   MARKERS: rs1042602 rs1800498
+   D' = 0.234839
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.091844 -0.028188  2.175182  0.140253
+   A     T      0.160125  0.028188  2.175182  0.140253
+   C     C      0.384534  0.028188  2.175182  0.140253
+   C     T      0.363497 -0.028188  2.175182  0.140253
+
+   MARKERS: rs1800498 rs1079598
+   D' = 1
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.141129  0.075117 24.423596  0.000001
+   C     T      0.326613 -0.075117 24.423596  0.000001
+   T     C      0.000000 -0.075117 24.423596  0.000001
+   T     T      0.532258  0.075117 24.423596  0.000001
+
+   MARKERS: rs1079598 tsc0039147
+   D' = 0.398911
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.119299  0.012551  0.982673  0.321540
+   C     T      0.018912 -0.012551  0.982673  0.321540
+   T     C      0.653058 -0.012551  0.982673  0.321540
+   T     T      0.208730  0.012551  0.982673  0.321540
+
+   MARKERS: tsc0039147 tsc0055196
+   D' = 0.442121
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.074536 -0.059070 18.640834  0.000016
+   C     C      0.702808  0.059070 18.640834  0.000016
+   T     A      0.097339  0.059070 18.640834  0.000016
+   T     C      0.125317 -0.059070 18.640834  0.000016
+
+   MARKERS: tsc0055196 rs1800404
+   D' = 0.311107
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     A      0.075611 -0.034146  4.911401  0.026680
+   A     G      0.087088  0.034146  4.911401  0.026680
+   C     A      0.598992  0.034146  4.911401  0.026680
+   C     G      0.238309 -0.034146  4.911401  0.026680
+
+   MARKERS: rs1800404 rs2862
+   D' = 0.145386
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.209125  0.013704  0.546254  0.459852
+   A     T      0.465478 -0.013704  0.546254  0.459852
+   G     C      0.080557 -0.013704  0.546254  0.459852
+   G     T      0.244839  0.013704  0.546254  0.459852
+
+   MARKERS: rs2862 tsc0055903
+   D' = 0.0653092
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.194033 -0.012719  0.521619  0.470152
+   C     T      0.089967  0.012719  0.521619  0.470152
+   T     C      0.533967  0.012719  0.521619  0.470152
+   T     T      0.182033 -0.012719  0.521619  0.470152
+
+   MARKERS: tsc0055903 tsc0473031
+   D' = 0.451892
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.531877  0.074262 15.384778  0.000088
+   C     T      0.203895 -0.074262 15.384778  0.000088
+   T     C      0.090074 -0.074262 15.384778  0.000088
+   T     T      0.174153  0.074262 15.384778  0.000088
+
+   MARKERS: tsc0473031 rs4646
+   D' = 0.0458974
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     G      0.470632  0.007238  0.152787  0.695886
+   C     T      0.150462 -0.007238  0.152787  0.695886
+   T     G      0.275462 -0.007238  0.152787  0.695886
+   T     T      0.103445  0.007238  0.152787  0.695886
+
+   MARKERS: rs4646 tsc1472708
+   D' = 0.12124
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   G     C      0.167816 -0.022614  1.852803  0.173458
+   G     G      0.582184  0.022614  1.852803  0.173458
+   T     C      0.086091  0.022614  1.852803  0.173458
+   T     G      0.163909 -0.022614  1.852803  0.173458
+
+   MARKERS: tsc1472708 rs2891
+   D' = 0.351575
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.181635  0.039254  4.282443  0.038508
+   C     G      0.072397 -0.039254  4.282443  0.038508
+   G     A      0.378849 -0.039254  4.282443  0.038508
+   G     G      0.367119  0.039254  4.282443  0.038508
+
+   MARKERS: rs2891 rs2816
+   D' = 0.026566
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.354663  0.005495  0.067481  0.795040
+   A     T      0.201337 -0.005495  0.067481  0.795040
+   G     C      0.273337 -0.005495  0.067481  0.795040
+   G     T      0.170663  0.005495  0.067481  0.795040
+
+   MARKERS: rs2816 tsc0051129
+   D' = 0.532634
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.218043  0.054510  8.443800  0.003663
+   C     G      0.397037 -0.054510  8.443800  0.003663
+   T     C      0.047830 -0.054510  8.443800  0.003663
+   T     G      0.337090  0.054510  8.443800  0.003663
+
+   MARKERS: tsc0051129 tsc0041150
+   D' = 0.326301
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.207585  0.015089  0.978611  0.322542
+   C     G      0.031153 -0.015089  0.978611  0.322542
+   G     A      0.598721 -0.015089  0.978611  0.322542
+   G     G      0.162540  0.015089  0.978611  0.322542
+
+   MARKERS: tsc0041150 tsc0549661
+   D' = 0.153431
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   A     C      0.225425  0.008063  0.279562  0.596989
+   A     T      0.579885 -0.008063  0.279562  0.596989
+   G     C      0.044486 -0.008063  0.279562  0.596989
+   G     T      0.150204  0.008063  0.279562  0.596989
+
+   MARKERS: tsc0549661 rs4884
+   D' = 0.862134
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     C      0.044742 -0.155717 87.548297  0.000000
+   C     T      0.221131  0.155717 87.548297  0.000000
+   T     C      0.709226  0.155717 87.548297  0.000000
+   T     T      0.024901 -0.155717 87.548297  0.000000
+
+   MARKERS: rs4884 tsc0042022
+   D' = 0.0493321
+   ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+   C     A      0.142217 -0.007380  0.238554  0.625253
+   C     G      0.611751  0.007380  0.238554  0.625253
+   T     A      0.056196  0.007380  0.238554  0.625253
+   T     G      0.189836 -0.007380  0.238554  0.625253
+
+POPULATION: 1
+
+   ALL  (N = 202)
+
+      MARKERS: rs140864 tsc1291477
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      D     A      0.000000 -0.001591  0.869204  0.351176
+      D     G      0.002538  0.001591  0.869204  0.351176
+      I     A      0.626904  0.001591  0.869204  0.351176
+      I     G      0.370558 -0.001591  0.869204  0.351176
+
+      MARKERS: tsc1291477 tsc0058017
+      D' = 0.407141
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.017530 -0.012039  2.779690  0.095467
+      A     G      0.604970  0.012039  2.779690  0.095467
+      G     A      0.029970  0.012039  2.779690  0.095467
+      G     G      0.347530 -0.012039  2.779690  0.095467
+
+      MARKERS: tsc0058017 tsc0268195
+      D' = 0.0262988
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.009227  0.001034  0.033739  0.854263
+      A     T      0.038273 -0.001034  0.033739  0.854263
+      G     G      0.163273 -0.001034  0.033739  0.854263
+      G     T      0.789227  0.001034  0.033739  0.854263
+
+      MARKERS: tsc0268195 rs2814778
+      D' = 0.191699
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.132116  0.008395  0.519904  0.470883
+      G     G      0.035397 -0.008395  0.519904  0.470883
+      T     A      0.606463 -0.008395  0.519904  0.470883
+      T     G      0.226025  0.008395  0.519904  0.470883
+
+      MARKERS: rs2814778 tsc0053865
+      D' = 0.107704
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.678060  0.007622  0.717960  0.396814
+      A     T      0.063146 -0.007622  0.717960  0.396814
+      G     A      0.226463 -0.007622  0.717960  0.396814
+      G     T      0.032331  0.007622  0.717960  0.396814
+
+      MARKERS: tsc0053865 tsc0057526
+      D' = 0.00145754
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.121767 -0.000118  0.000286  0.986513
+      A     C      0.784324  0.000118  0.000286  0.986513
+      T     A      0.012751  0.000118  0.000286  0.986513
+      T     C      0.081158 -0.000118  0.000286  0.986513
+
+      MARKERS: tsc0057526 rs6003
+      D' = 0.116595
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.117140 -0.007717  1.496022  0.221285
+      A     G      0.018064  0.007717  1.496022  0.221285
+      C     A      0.806329  0.007717  1.496022  0.221285
+      C     G      0.058467 -0.007717  1.496022  0.221285
+
+      MARKERS: rs6003 rs2065160
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.002538  0.000180  0.037708  0.846031
+      A     T      0.926396 -0.000180  0.037708  0.846031
+      G     C      0.000000 -0.000180  0.037708  0.846031
+      G     T      0.071066  0.000180  0.037708  0.846031
+
+      MARKERS: rs2065160 tsc0755351
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.002525  0.000338  0.077745  0.780377
+      C     G      0.000000 -0.000338  0.077745  0.780377
+      T     A      0.863636 -0.000338  0.077745  0.780377
+      T     G      0.133838  0.000338  0.077745  0.780377
+
+      MARKERS: tsc0755351 rs2752
+      D' = 0.00287527
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.487747  0.000221  0.000341  0.985268
+      A     T      0.376115 -0.000221  0.000341  0.985268
+      G     G      0.076610 -0.000221  0.000341  0.985268
+      G     T      0.059529  0.000221  0.000341  0.985268
+
+      MARKERS: rs2752 tsc0376342
+      D' = 0.368347
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.545475 -0.004759  0.642620  0.422764
+      G     C      0.021689  0.004759  0.642620  0.422764
+      T     A      0.424675  0.004759  0.642620  0.422764
+      T     C      0.008161 -0.004759  0.642620  0.422764
+
+      MARKERS: tsc0376342 rs17203
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.806701 -0.005022  1.298741  0.254443
+      A     G      0.162371  0.005022  1.298741  0.254443
+      C     C      0.030928  0.005022  1.298741  0.254443
+      C     G      0.000000 -0.005022  1.298741  0.254443
+
+      MARKERS: rs17203 tsc0075980
+      D' = 0.872879
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.767231 -0.009901  2.290558  0.130163
+      C     T      0.066979  0.009901  2.290558  0.130163
+      G     A      0.164347  0.009901  2.290558  0.130163
+      G     T      0.001442 -0.009901  2.290558  0.130163
+
+      MARKERS: tsc0075980 tsc0380878
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.698454 -0.015716  4.398005  0.035981
+      A     T      0.234536  0.015716  4.398005  0.035981
+      T     C      0.067010  0.015716  4.398005  0.035981
+      T     T      0.000000 -0.015716  4.398005  0.035981
+
+      MARKERS: tsc0380878 tsc1365914
+      D' = 0.124295
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.085160 -0.012087  1.450844  0.228393
+      C     C      0.685042  0.012087  1.450844  0.228393
+      T     A      0.041102  0.012087  1.450844  0.228393
+      T     C      0.188696 -0.012087  1.450844  0.228393
+
+      MARKERS: tsc1365914 tsc0357650
+      D' = 0.10672
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.035417  0.011758  1.683436  0.194468
+      A     T      0.098422 -0.011758  1.683436  0.194468
+      C     C      0.141351 -0.011758  1.683436  0.194468
+      C     T      0.724811  0.011758  1.683436  0.194468
+
+      MARKERS: tsc0357650 tsc0043383
+      D' = 0.0464389
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.086928  0.004427  0.109898  0.740260
+      C     G      0.090907 -0.004427  0.109898  0.740260
+      T     A      0.376990 -0.004427  0.109898  0.740260
+      T     G      0.445175  0.004427  0.109898  0.740260
+
+      MARKERS: tsc0043383 rs3309
+      D' = 0.112866
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.330601 -0.015260  1.002695  0.316659
+      A     T      0.131328  0.015260  1.002695  0.316659
+      G     A      0.418130  0.015260  1.002695  0.316659
+      G     T      0.119941 -0.015260  1.002695  0.316659
+
+      MARKERS: rs3309 rs3317
+      D' = 0.0472698
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.413348 -0.005252  0.119800  0.729251
+      A     G      0.334152  0.005252  0.119800  0.729251
+      T     A      0.146652  0.005252  0.119800  0.729251
+      T     G      0.105848 -0.005252  0.119800  0.729251
+
+      MARKERS: rs3317 tsc0696884
+      D' = 0.0146794
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.092669  0.001065  0.006830  0.934136
+      A     T      0.465412 -0.001065  0.006830  0.934136
+      G     A      0.071472 -0.001065  0.006830  0.934136
+      G     T      0.370447  0.001065  0.006830  0.934136
+
+      MARKERS: tsc0696884 rs3340
+      D' = 0.0390604
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.129208 -0.005252  0.281161  0.595941
+      A     G      0.034005  0.005252  0.281161  0.595941
+      T     A      0.694626  0.005252  0.281161  0.595941
+      T     G      0.142161 -0.005252  0.281161  0.595941
+
+      MARKERS: rs3340 rs2763
+      D' = 0.18184
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.136429  0.005169  0.280657  0.596271
+      A     G      0.685560 -0.005169  0.280657  0.596271
+      G     C      0.023257 -0.005169  0.280657  0.596271
+      G     G      0.154754  0.005169  0.280657  0.596271
+
+      MARKERS: rs2763 rs2161
+      D' = 0.0396247
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.049864 -0.002057  0.029358  0.863955
+      C     G      0.107497  0.002057  0.029358  0.863955
+      G     A      0.280086  0.002057  0.029358  0.863955
+      G     G      0.562554 -0.002057  0.029358  0.863955
+
+      MARKERS: rs2161 tsc1612346
+      D' = 0.0794156
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.084356  0.012218  0.784833  0.375667
+      A     G      0.234853 -0.012218  0.784833  0.375667
+      G     A      0.141633 -0.012218  0.784833  0.375667
+      G     G      0.539158  0.012218  0.784833  0.375667
+
+      MARKERS: tsc1612346 tsc0800273
+      D' = 0.156786
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.153251 -0.025271  4.360204  0.036788
+      A     T      0.072182  0.025271  4.360204  0.036788
+      G     C      0.638656  0.025271  4.360204  0.036788
+      G     T      0.135910 -0.025271  4.360204  0.036788
+
+      MARKERS: tsc0800273 tsc0988681
+      D' = 0.0495498
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.667697  0.005962  0.331572  0.564735
+      C     T      0.114354 -0.005962  0.331572  0.564735
+      T     C      0.178457 -0.005962  0.331572  0.564735
+      T     T      0.039492  0.005962  0.331572  0.564735
+
+      MARKERS: tsc0988681 rs2695
+      D' = 0.58402
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.239243  0.022193  4.107394  0.042696
+      C     G      0.611767 -0.022193  4.107394  0.042696
+      T     A      0.015807 -0.022193  4.107394  0.042696
+      T     G      0.133183  0.022193  4.107394  0.042696
+
+      MARKERS: rs2695 tsc0927612
+      D' = 0.0377174
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.220175 -0.003680  0.123153  0.725640
+      A     T      0.037557  0.003680  0.123153  0.725640
+      G     C      0.648382  0.003680  0.123153  0.725640
+      G     T      0.093886 -0.003680  0.123153  0.725640
+
+      MARKERS: tsc0927612 tsc0813195
+      D' = 0.00545987
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.152269 -0.000611  0.004431  0.946928
+      C     T      0.711834  0.000611  0.004431  0.946928
+      T     A      0.024654  0.000611  0.004431  0.946928
+      T     T      0.111243 -0.000611  0.004431  0.946928
+
+      MARKERS: tsc0813195 tsc0010190
+      D' = 0.0801738
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.168152 -0.002991  0.287728  0.591680
+      A     T      0.011141  0.002991  0.287728  0.591680
+      T     C      0.786393  0.002991  0.287728  0.591680
+      T     T      0.034314 -0.002991  0.287728  0.591680
+
+      MARKERS: tsc0010190 tsc0717625
+      D' = 0.344338
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.035626 -0.014751 19.766715  0.000009
+      C     T      0.919148  0.014751 19.766715  0.000009
+      T     C      0.017138  0.014751 19.766715  0.000009
+      T     T      0.028088 -0.014751 19.766715  0.000009
+
+      MARKERS: tsc0717625 rs594689
+      D' = 0.424246
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.015596 -0.011492  2.072645  0.149961
+      C     G      0.039404  0.011492  2.072645  0.149961
+      T     A      0.476904  0.011492  2.072645  0.149961
+      T     G      0.468096 -0.011492  2.072645  0.149961
+
+      MARKERS: rs594689 rs1042602
+      D' = 0.0621494
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.191765  0.011435  0.456921  0.499067
+      A     C      0.303210 -0.011435  0.456921  0.499067
+      G     A      0.172557 -0.011435  0.456921  0.499067
+      G     C      0.332469  0.011435  0.456921  0.499067
+
+      MARKERS: rs1042602 rs1800498
+      D' = 0.0715364
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.132150 -0.010182  0.379927  0.537642
+      A     T      0.231486  0.010182  0.379927  0.537642
+      C     C      0.259264  0.010182  0.379927  0.537642
+      C     T      0.377100 -0.010182  0.379927  0.537642
+
+      MARKERS: rs1800498 rs1079598
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.180628  0.109701 69.479667  0.000000
+      C     T      0.212042 -0.109701 69.479667  0.000000
+      T     C      0.000000 -0.109701 69.479667  0.000000
+      T     T      0.607330  0.109701 69.479667  0.000000
+
+      MARKERS: rs1079598 tsc0039147
+      D' = 0.0738562
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.143640 -0.008741  0.873151  0.350085
+      C     T      0.034371  0.008741  0.873151  0.350085
+      T     C      0.712381  0.008741  0.873151  0.350085
+      T     T      0.109608 -0.008741  0.873151  0.350085
+
+      MARKERS: tsc0039147 tsc0055196
+      D' = 0.0721836
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.047875 -0.003725  0.416526  0.518676
+      C     C      0.812125  0.003725  0.416526  0.518676
+      T     A      0.012125  0.003725  0.416526  0.518676
+      T     C      0.127875 -0.003725  0.416526  0.518676
+
+      MARKERS: tsc0055196 rs1800404
+      D' = 0.199377
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.036239 -0.009024  1.486649  0.222737
+      A     G      0.025938  0.009024  1.486649  0.222737
+      C     A      0.691741  0.009024  1.486649  0.222737
+      C     G      0.246083 -0.009024  1.486649  0.222737
+
+      MARKERS: rs1800404 rs2862
+      D' = 0.38068
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.203254  0.025498  3.598114  0.057845
+      A     T      0.523061 -0.025498  3.598114  0.057845
+      G     C      0.041482 -0.025498  3.598114  0.057845
+      G     T      0.232202  0.025498  3.598114  0.057845
+
+      MARKERS: rs2862 tsc0055903
+      D' = 0.0548515
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.204216 -0.006017  0.321971  0.570426
+      C     T      0.041816  0.006017  0.321971  0.570426
+      T     C      0.650281  0.006017  0.321971  0.570426
+      T     T      0.103687 -0.006017  0.321971  0.570426
+
+      MARKERS: tsc0055903 tsc0473031
+      D' = 0.0303954
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.640607  0.003179  0.085817  0.769564
+      C     T      0.218436 -0.003179  0.085817  0.769564
+      T     C      0.101414 -0.003179  0.085817  0.769564
+      T     T      0.039543  0.003179  0.085817  0.769564
+
+      MARKERS: tsc0473031 rs4646
+      D' = 0.0392097
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     G      0.535464 -0.002780  0.041300  0.838961
+      C     T      0.203230  0.002780  0.041300  0.838961
+      T     G      0.193179  0.002780  0.041300  0.838961
+      T     T      0.068127 -0.002780  0.041300  0.838961
+
+      MARKERS: rs4646 tsc1472708
+      D' = 0.173743
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     C      0.095678  0.005640  0.305203  0.580639
+      G     G      0.639322 -0.005640  0.305203  0.580639
+      T     C      0.026822 -0.005640  0.305203  0.580639
+      T     G      0.238178  0.005640  0.305203  0.580639
+
+      MARKERS: tsc1472708 rs2891
+      D' = 2.77556e-17
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.062821 -0.000000  0.000000  1.000000
+      C     G      0.062821  0.000000  0.000000  1.000000
+      G     A      0.437179  0.000000  0.000000  1.000000
+      G     G      0.437179  0.000000  0.000000  1.000000
+
+      MARKERS: rs2891 rs2816
+      D' = 0.12724
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.246827 -0.028547  2.657631  0.103054
+      A     T      0.250622  0.028547  2.657631  0.103054
+      G     C      0.306745  0.028547  2.657631  0.103054
+      G     T      0.195806 -0.028547  2.657631  0.103054
+
+      MARKERS: rs2816 tsc0051129
+      D' = 0.318599
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.095158  0.020247  2.813719  0.093461
+      C     G      0.445867 -0.020247  2.813719  0.093461
+      T     C      0.043303 -0.020247  2.813719  0.093461
+      T     G      0.415671  0.020247  2.813719  0.093461
+
+      MARKERS: tsc0051129 tsc0041150
+      D' = 0.186544
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.102582  0.005627  0.292567  0.588580
+      C     G      0.024537 -0.005627  0.292567  0.588580
+      G     A      0.660130 -0.005627  0.292567  0.588580
+      G     G      0.212751  0.005627  0.292567  0.588580
+
+      MARKERS: tsc0041150 tsc0549661
+      D' = 0.177803
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.248031  0.013496  0.933061  0.334069
+      A     T      0.507463 -0.013496  0.933061  0.334069
+      G     C      0.062408 -0.013496  0.933061  0.334069
+      G     T      0.182097  0.013496  0.933061  0.334069
+
+      MARKERS: tsc0549661 rs4884
+      D' = 0.855617
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.046689 -0.171924 135.230556  0.000000
+      C     T      0.261392  0.171924 135.230556  0.000000
+      T     C      0.662907  0.171924 135.230556  0.000000
+      T     T      0.029012 -0.171924 135.230556  0.000000
+
+      MARKERS: rs4884 tsc0042022
+      D' = 0.103955
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.033627  0.001372  0.043365  0.835040
+      C     G      0.675969 -0.001372  0.043365  0.835040
+      T     A      0.011828 -0.001372  0.043365  0.835040
+      T     G      0.278576  0.001372  0.043365  0.835040
+
+   UNAFFECTED  (N = 100)
+
+      MARKERS: rs140864 tsc1291477
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      D     A      0.000000 -0.003061  0.783817  0.375976
+      D     G      0.005051  0.003061  0.783817  0.375976
+      I     A      0.606061  0.003061  0.783817  0.375976
+      I     G      0.388889 -0.003061  0.783817  0.375976
+
+      MARKERS: tsc1291477 tsc0058017
+      D' = 0.507563
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.018023 -0.018577  2.571984  0.108771
+      A     G      0.591977  0.018577  2.571984  0.108771
+      G     A      0.041977  0.018577  2.571984  0.108771
+      G     G      0.348023 -0.018577  2.571984  0.108771
+
+      MARKERS: tsc0058017 tsc0268195
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.000000 -0.009489  1.208895  0.271551
+      A     T      0.060606  0.009489  1.208895  0.271551
+      G     G      0.156566  0.009489  1.208895  0.271551
+      G     T      0.782828 -0.009489  1.208895  0.271551
+
+      MARKERS: tsc0268195 rs2814778
+      D' = 0.392018
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.119000  0.016332  0.989782  0.319796
+      G     G      0.025330 -0.016332  0.989782  0.319796
+      T     A      0.592340 -0.016332  0.989782  0.319796
+      T     G      0.263330  0.016332  0.989782  0.319796
+
+      MARKERS: rs2814778 tsc0053865
+      D' = 0.186093
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.657929  0.012885  0.946300  0.330663
+      A     T      0.056357 -0.012885  0.946300  0.330663
+      G     A      0.245132 -0.012885  0.946300  0.330663
+      G     T      0.040582  0.012885  0.946300  0.330663
+
+      MARKERS: tsc0053865 tsc0057526
+      D' = 0.38317
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.142547  0.005571  0.280794  0.596181
+      A     C      0.761494 -0.005571  0.280794  0.596181
+      T     A      0.008968 -0.005571  0.280794  0.596181
+      T     C      0.086991  0.005571  0.280794  0.596181
+
+      MARKERS: tsc0057526 rs6003
+      D' = 0.123104
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.129538 -0.008968  0.804354  0.369795
+      A     G      0.021977  0.008968  0.804354  0.369795
+      C     A      0.784603  0.008968  0.804354  0.369795
+      C     G      0.063882 -0.008968  0.804354  0.369795
+
+      MARKERS: rs6003 rs2065160
+      D' = 0
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.000000  0.000000   ******    ******
+      A     T      0.918367  0.000000   ******    ******
+      G     C      0.000000  0.000000   ******    ******
+      G     T      0.081633  0.000000   ******    ******
+
+      MARKERS: rs2065160 tsc0755351
+      D' = 0
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.000000  0.000000   ******    ******
+      C     G      0.000000  0.000000   ******    ******
+      T     A      0.857143  0.000000   ******    ******
+      T     G      0.142857  0.000000   ******    ******
+
+      MARKERS: tsc0755351 rs2752
+      D' = 0.226825
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.468172  0.016672  0.925713  0.335979
+      A     T      0.391828 -0.016672  0.925713  0.335979
+      G     G      0.056828 -0.016672  0.925713  0.335979
+      G     T      0.083172  0.016672  0.925713  0.335979
+
+      MARKERS: rs2752 tsc0376342
+      D' = 0.270272
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.508666 -0.003209  0.169462  0.680590
+      G     C      0.016334  0.003209  0.169462  0.680590
+      T     A      0.466334  0.003209  0.169462  0.680590
+      T     C      0.008666 -0.003209  0.169462  0.680590
+
+      MARKERS: tsc0376342 rs17203
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.789474 -0.004848  0.641543  0.423153
+      A     G      0.184211  0.004848  0.641543  0.423153
+      C     C      0.026316  0.004848  0.641543  0.423153
+      C     G      0.000000 -0.004848  0.641543  0.423153
+
+      MARKERS: rs17203 tsc0075980
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.763441 -0.009105  1.259189  0.261805
+      C     T      0.048387  0.009105  1.259189  0.261805
+      G     A      0.188172  0.009105  1.259189  0.261805
+      G     T      0.000000 -0.009105  1.259189  0.261805
+
+      MARKERS: tsc0075980 tsc0380878
+      D' = 0.587511
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.692636 -0.007315  0.634519  0.425703
+      A     T      0.260489  0.007315  0.634519  0.425703
+      T     C      0.041739  0.007315  0.634519  0.425703
+      T     T      0.005136 -0.007315  0.634519  0.425703
+
+      MARKERS: tsc0380878 tsc1365914
+      D' = 0.191264
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.083547 -0.019759  1.622353  0.202764
+      C     C      0.658721  0.019759  1.622353  0.202764
+      T     A      0.055628  0.019759  1.622353  0.202764
+      T     C      0.202103 -0.019759  1.622353  0.202764
+
+      MARKERS: tsc1365914 tsc0357650
+      D' = 0.140357
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.042182  0.017271  1.717902  0.189963
+      A     T      0.105777 -0.017271  1.717902  0.189963
+      C     C      0.126185 -0.017271  1.717902  0.189963
+      C     T      0.725856  0.017271  1.717902  0.189963
+
+      MARKERS: tsc0357650 tsc0043383
+      D' = 0.107941
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.091103  0.009559  0.263410  0.607787
+      C     G      0.079000 -0.009559  0.263410  0.607787
+      T     A      0.388278 -0.009559  0.263410  0.607787
+      T     G      0.441619  0.009559  0.263410  0.607787
+
+      MARKERS: tsc0043383 rs3309
+      D' = 0.0840752
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.339219 -0.011936  0.289416  0.590595
+      A     T      0.145474  0.011936  0.289416  0.590595
+      G     A      0.385270  0.011936  0.289416  0.590595
+      G     T      0.130036 -0.011936  0.289416  0.590595
+
+      MARKERS: rs3309 rs3317
+      D' = 0.066042
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.415046  0.009896  0.201193  0.653759
+      A     G      0.314954 -0.009896  0.201193  0.653759
+      T     A      0.139954 -0.009896  0.201193  0.653759
+      T     G      0.130046  0.009896  0.201193  0.653759
+
+      MARKERS: rs3317 tsc0696884
+      D' = 0.18684
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.068448 -0.015727  0.779010  0.377444
+      A     T      0.487108  0.015727  0.779010  0.377444
+      G     A      0.083067  0.015727  0.779010  0.377444
+      G     T      0.361377 -0.015727  0.779010  0.377444
+
+      MARKERS: tsc0696884 rs3340
+      D' = 0.440363
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.137346  0.012028  0.772185  0.379542
+      A     G      0.015285 -0.012028  0.772185  0.379542
+      T     A      0.683706 -0.012028  0.772185  0.379542
+      T     G      0.163662  0.012028  0.772185  0.379542
+
+      MARKERS: rs3340 rs2763
+      D' = 0.561198
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.126097  0.013742  1.136143  0.286469
+      A     G      0.694956 -0.013742  1.136143  0.286469
+      G     C      0.010745 -0.013742  1.136143  0.286469
+      G     G      0.168202  0.013742  1.136143  0.286469
+
+      MARKERS: rs2763 rs2161
+      D' = 0.0278799
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.047122  0.002453  0.023562  0.878004
+      C     G      0.085531 -0.002453  0.023562  0.878004
+      G     A      0.289613 -0.002453  0.023562  0.878004
+      G     G      0.577734  0.002453  0.023562  0.878004
+
+      MARKERS: rs2161 tsc1612346
+      D' = 0.137033
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.098670  0.022140  1.216823  0.269985
+      A     G      0.222758 -0.022140  1.216823  0.269985
+      G     A      0.139425 -0.022140  1.216823  0.269985
+      G     G      0.539146  0.022140  1.216823  0.269985
+
+      MARKERS: tsc1612346 tsc0800273
+      D' = 0.176022
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.159855 -0.028874  2.563594  0.109350
+      A     T      0.080886  0.028874  2.563594  0.109350
+      G     C      0.624096  0.028874  2.563594  0.109350
+      G     T      0.135163 -0.028874  2.563594  0.109350
+
+      MARKERS: tsc0800273 tsc0988681
+      D' = 0.0038788
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.651821  0.000424  0.000836  0.976930
+      C     T      0.108817 -0.000424  0.000836  0.976930
+      T     C      0.204562 -0.000424  0.000836  0.976930
+      T     T      0.034800  0.000424  0.000836  0.976930
+
+      MARKERS: tsc0988681 rs2695
+      D' = 0.480404
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.217884  0.015247  1.089672  0.296544
+      C     G      0.646699 -0.015247  1.089672  0.296544
+      T     A      0.016491 -0.015247  1.089672  0.296544
+      T     G      0.118926  0.015247  1.089672  0.296544
+
+      MARKERS: rs2695 tsc0927612
+      D' = 0.276301
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.173172 -0.027936  3.626731  0.056858
+      A     T      0.058407  0.027936  3.626731  0.056858
+      G     C      0.695249  0.027936  3.626731  0.056858
+      G     T      0.073172 -0.027936  3.626731  0.056858
+
+      MARKERS: tsc0927612 tsc0813195
+      D' = 0.154557
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.125117 -0.018112  1.925105  0.165295
+      C     T      0.734258  0.018112  1.925105  0.165295
+      T     A      0.041550  0.018112  1.925105  0.165295
+      T     T      0.099075 -0.018112  1.925105  0.165295
+
+      MARKERS: tsc0813195 tsc0010190
+      D' = 0.206023
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.157465 -0.008759  1.113956  0.291224
+      A     T      0.017792  0.008759  1.113956  0.291224
+      T     C      0.790988  0.008759  1.113956  0.291224
+      T     T      0.033754 -0.008759  1.113956  0.291224
+
+      MARKERS: tsc0010190 tsc0717625
+      D' = 0.46679
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.030780 -0.022479 18.504852  0.000017
+      C     T      0.918200  0.022479 18.504852  0.000017
+      T     C      0.025343  0.022479 18.504852  0.000017
+      T     T      0.025678 -0.022479 18.504852  0.000017
+
+      MARKERS: tsc0717625 rs594689
+      D' = 0.359223
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.020202 -0.011325  0.911162  0.339806
+      C     G      0.040404  0.011325  0.911162  0.339806
+      T     A      0.500000  0.011325  0.911162  0.339806
+      T     G      0.439394 -0.011325  0.911162  0.339806
+
+      MARKERS: rs594689 rs1042602
+      D' = 0.154498
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.237132  0.029576  1.460305  0.226882
+      A     C      0.283070 -0.029576  1.460305  0.226882
+      G     A      0.161858 -0.029576  1.460305  0.226882
+      G     C      0.317940  0.029576  1.460305  0.226882
+
+      MARKERS: rs1042602 rs1800498
+      D' = 0.165647
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.131099 -0.026028  1.187712  0.275791
+      A     T      0.272941  0.026028  1.187712  0.275791
+      C     C      0.257790  0.026028  1.187712  0.275791
+      C     T      0.338170 -0.026028  1.187712  0.275791
+
+      MARKERS: rs1800498 rs1079598
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.207447  0.124689 40.103210  0.000000
+      C     T      0.191489 -0.124689 40.103210  0.000000
+      T     C      0.000000 -0.124689 40.103210  0.000000
+      T     T      0.601064  0.124689 40.103210  0.000000
+
+      MARKERS: rs1079598 tsc0039147
+      D' = 0.108459
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.159243 -0.013610  0.890583  0.345319
+      C     T      0.046020  0.013610  0.890583  0.345319
+      T     C      0.682862  0.013610  0.890583  0.345319
+      T     T      0.111875 -0.013610  0.890583  0.345319
+
+      MARKERS: tsc0039147 tsc0055196
+      D' = 0.110617
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.056698 -0.007052  0.562204  0.453373
+      C     C      0.793302  0.007052  0.562204  0.453373
+      T     A      0.018302  0.007052  0.562204  0.453373
+      T     C      0.131698 -0.007052  0.562204  0.453373
+
+      MARKERS: tsc0055196 rs1800404
+      D' = 0.511012
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.027562 -0.028803  5.682865  0.017131
+      A     G      0.053083  0.028803  5.682865  0.017131
+      C     A      0.671363  0.028803  5.682865  0.017131
+      C     G      0.247992 -0.028803  5.682865  0.017131
+
+      MARKERS: rs1800404 rs2862
+      D' = 0.66655
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.174633  0.039602  4.731689  0.029612
+      A     T      0.519811 -0.039602  4.731689  0.029612
+      G     C      0.019811 -0.039602  4.731689  0.029612
+      G     T      0.285744  0.039602  4.731689  0.029612
+
+      MARKERS: rs2862 tsc0055903
+      D' = 0.155342
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.172471  0.005263  0.127698  0.720831
+      C     T      0.028616 -0.005263  0.127698  0.720831
+      T     C      0.659051 -0.005263  0.127698  0.720831
+      T     T      0.139862  0.005263  0.127698  0.720831
+
+      MARKERS: tsc0055903 tsc0473031
+      D' = 0.146977
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.622296  0.017322  1.091603  0.296116
+      C     T      0.214661 -0.017322  1.091603  0.296116
+      T     C      0.100531 -0.017322  1.091603  0.296116
+      T     T      0.062513  0.017322  1.091603  0.296116
+
+      MARKERS: tsc0473031 rs4646
+      D' = 0.00972347
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     G      0.508276  0.001873  0.008446  0.926775
+      C     T      0.216214 -0.001873  0.008446  0.926775
+      T     G      0.190704 -0.001873  0.008446  0.926775
+      T     T      0.084807  0.001873  0.008446  0.926775
+
+      MARKERS: rs4646 tsc1472708
+      D' = 0.657185
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     C      0.112359  0.024234  2.581730  0.108103
+      G     G      0.592641 -0.024234  2.581730  0.108103
+      T     C      0.012641 -0.024234  2.581730  0.108103
+      T     G      0.282359  0.024234  2.581730  0.108103
+
+      MARKERS: tsc1472708 rs2891
+      D' = 0.301049
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.083430  0.019004  1.320869  0.250436
+      C     G      0.044121 -0.019004  1.320869  0.250436
+      G     A      0.421672 -0.019004  1.320869  0.250436
+      G     G      0.450777  0.019004  1.320869  0.250436
+
+      MARKERS: rs2891 rs2816
+      D' = 0.0410618
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.263836 -0.009331  0.140228  0.708055
+      A     T      0.241266  0.009331  0.140228  0.708055
+      G     C      0.276980  0.009331  0.140228  0.708055
+      G     T      0.217918 -0.009331  0.140228  0.708055
+
+      MARKERS: rs2816 tsc0051129
+      D' = 0.190955
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.083719  0.011873  0.488944  0.484399
+      C     G      0.452364 -0.011873  0.488944  0.484399
+      T     C      0.050302 -0.011873  0.488944  0.484399
+      T     G      0.413616  0.011873  0.488944  0.484399
+
+      MARKERS: tsc0051129 tsc0041150
+      D' = 0.117793
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.099114  0.004019  0.069462  0.792121
+      C     G      0.030099 -0.004019  0.069462  0.792121
+      G     A      0.636841 -0.004019  0.069462  0.792121
+      G     G      0.233946  0.004019  0.069462  0.792121
+
+      MARKERS: tsc0041150 tsc0549661
+      D' = 0.201025
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.258105  0.018472  0.764503  0.381923
+      A     T      0.464722 -0.018472  0.764503  0.381923
+      G     C      0.073417 -0.018472  0.764503  0.381923
+      G     T      0.203757  0.018472  0.764503  0.381923
+
+      MARKERS: tsc0549661 rs4884
+      D' = 0.807239
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.042187 -0.176668 63.047220  0.000000
+      C     T      0.286096  0.176668 63.047220  0.000000
+      T     C      0.624480  0.176668 63.047220  0.000000
+      T     T      0.047237 -0.176668 63.047220  0.000000
+
+      MARKERS: rs4884 tsc0042022
+      D' = 0.6056
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.048252  0.011215  1.088940  0.296706
+      C     G      0.618415 -0.011215  1.088940  0.296706
+      T     A      0.007304 -0.011215  1.088940  0.296706
+      T     G      0.326030  0.011215  1.088940  0.296706
+
+   AFFECTED  (N = 102)
+
+      MARKERS: rs140864 tsc1291477
+      D' = 0
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      D     A      0.000000  0.000000   ******    ******
+      D     G      0.000000  0.000000   ******    ******
+      I     A      0.647959  0.000000   ******    ******
+      I     G      0.352041  0.000000   ******    ******
+
+      MARKERS: tsc1291477 tsc0058017
+      D' = 0.118262
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.023736  0.001511  0.030317  0.861773
+      A     G      0.611264 -0.001511  0.030317  0.861773
+      G     A      0.011264 -0.001511  0.030317  0.861773
+      G     G      0.353736  0.001511  0.030317  0.861773
+
+      MARKERS: tsc0058017 tsc0268195
+      D' = 0.376758
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.017119  0.010600  2.264739  0.132349
+      A     T      0.017535 -0.010600  2.264739  0.132349
+      G     G      0.171000 -0.010600  2.264739  0.132349
+      G     T      0.794347  0.010600  2.264739  0.132349
+
+      MARKERS: tsc0268195 rs2814778
+      D' = 0.00437885
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.144714 -0.000636  0.001515  0.968949
+      G     G      0.045286  0.000636  0.001515  0.968949
+      T     A      0.620286  0.000636  0.001515  0.968949
+      T     G      0.189714 -0.000636  0.001515  0.968949
+
+      MARKERS: rs2814778 tsc0053865
+      D' = 0.0124107
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.696048  0.000896  0.005427  0.941274
+      A     T      0.071279 -0.000896  0.005427  0.941274
+      G     A      0.209892 -0.000896  0.005427  0.941274
+      G     T      0.022781  0.000896  0.005427  0.941274
+
+      MARKERS: tsc0053865 tsc0057526
+      D' = 0.0403829
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.103297 -0.003273  0.124928  0.723750
+      A     C      0.804867  0.003273  0.124928  0.723750
+      T     A      0.014050  0.003273  0.124928  0.723750
+      T     C      0.077787 -0.003273  0.124928  0.723750
+
+      MARKERS: tsc0057526 rs6003
+      D' = 0.101003
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.104646 -0.005966  0.582024  0.445520
+      A     G      0.013910  0.005966  0.582024  0.445520
+      C     A      0.828343  0.005966  0.582024  0.445520
+      C     G      0.053100 -0.005966  0.582024  0.445520
+
+      MARKERS: rs6003 rs2065160
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.005051  0.000306  0.031900  0.858248
+      A     T      0.934343 -0.000306  0.031900  0.858248
+      G     C      0.000000 -0.000306  0.031900  0.858248
+      G     T      0.060606  0.000306  0.031900  0.858248
+
+      MARKERS: rs2065160 tsc0755351
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.005000  0.000625  0.069743  0.791712
+      C     G      0.000000 -0.000625  0.069743  0.791712
+      T     A      0.870000 -0.000625  0.069743  0.791712
+      T     G      0.125000  0.000625  0.069743  0.791712
+
+      MARKERS: tsc0755351 rs2752
+      D' = 0.463596
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.498777 -0.024363  2.202207  0.137813
+      A     T      0.368870  0.024363  2.202207  0.137813
+      G     G      0.104164  0.024363  2.202207  0.137813
+      G     T      0.028189 -0.024363  2.202207  0.137813
+
+      MARKERS: rs2752 tsc0376342
+      D' = 0.63472
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.579208 -0.008602  0.942520  0.331631
+      G     C      0.029703  0.008602  0.942520  0.331631
+      T     A      0.386139  0.008602  0.942520  0.331631
+      T     C      0.004950 -0.008602  0.942520  0.331631
+
+      MARKERS: tsc0376342 rs17203
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.823232 -0.004999  0.633049  0.426239
+      A     G      0.141414  0.004999  0.633049  0.426239
+      C     C      0.035354  0.004999  0.633049  0.426239
+      C     G      -0.000000 -0.004999  0.633049  0.426239
+
+      MARKERS: rs17203 tsc0075980
+      D' = 0.00885689
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.781353  0.000664  0.004521  0.946393
+      C     T      0.074317 -0.000664  0.004521  0.946393
+      G     A      0.131018 -0.000664  0.004521  0.946393
+      G     T      0.013312  0.000664  0.004521  0.946393
+
+      MARKERS: tsc0075980 tsc0380878
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.709184 -0.017701  2.390389  0.122083
+      A     T      0.204082  0.017701  2.390389  0.122083
+      T     C      0.086735  0.017701  2.390389  0.122083
+      T     T      0.000000 -0.017701  2.390389  0.122083
+
+      MARKERS: tsc0380878 tsc1365914
+      D' = 0.032127
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.087835 -0.002916  0.051630  0.820251
+      C     C      0.709194  0.002916  0.051630  0.820251
+      T     A      0.026026  0.002916  0.051630  0.820251
+      T     C      0.176944 -0.002916  0.051630  0.820251
+
+      MARKERS: tsc1365914 tsc0357650
+      D' = 0.0666741
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.028721  0.006521  0.277095  0.598611
+      A     T      0.091279 -0.006521  0.277095  0.598611
+      C     C      0.156279 -0.006521  0.277095  0.598611
+      C     T      0.723721  0.006521  0.277095  0.598611
+
+      MARKERS: tsc0357650 tsc0043383
+      D' = 0.0172988
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.081779 -0.001440  0.005692  0.939863
+      C     G      0.103788  0.001440  0.005692  0.939863
+      T     A      0.366675  0.001440  0.005692  0.939863
+      T     G      0.447758 -0.001440  0.005692  0.939863
+
+      MARKERS: tsc0043383 rs3309
+      D' = 0.133366
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.322539 -0.016992  0.664492  0.414979
+      A     T      0.116854  0.016992  0.664492  0.414979
+      G     A      0.450188  0.016992  0.664492  0.414979
+      G     T      0.110418 -0.016992  0.664492  0.414979
+
+      MARKERS: rs3309 rs3317
+      D' = 0.236336
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.408066 -0.024159  1.346280  0.245930
+      A     G      0.356934  0.024159  1.346280  0.245930
+      T     A      0.156934  0.024159  1.346280  0.245930
+      T     G      0.078066 -0.024159  1.346280  0.245930
+
+      MARKERS: rs3317 tsc0696884
+      D' = 0.227423
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.116761  0.017664  0.903977  0.341717
+      A     T      0.443845 -0.017664  0.903977  0.341717
+      G     A      0.060007 -0.017664  0.903977  0.341717
+      G     T      0.379387  0.017664  0.903977  0.341717
+
+      MARKERS: tsc0696884 rs3340
+      D' = 0.176297
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.118101 -0.025277  3.126346  0.077036
+      A     G      0.055369  0.025277  3.126346  0.077036
+      T     A      0.708430  0.025277  3.126346  0.077036
+      T     G      0.118101 -0.025277  3.126346  0.077036
+
+      MARKERS: rs3340 rs2763
+      D' = 0.0810134
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.138280 -0.011731  0.648405  0.420684
+      A     G      0.684637  0.011731  0.648405  0.420684
+      G     C      0.044012  0.011731  0.648405  0.420684
+      G     G      0.133072 -0.011731  0.648405  0.420684
+
+      MARKERS: rs2763 rs2161
+      D' = 0.0903791
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.053458 -0.005312  0.089100  0.765324
+      C     G      0.128360  0.005312  0.089100  0.765324
+      G     A      0.269774  0.005312  0.089100  0.765324
+      G     G      0.548407 -0.005312  0.089100  0.765324
+
+      MARKERS: rs2161 tsc1612346
+      D' = 0.0202916
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.071196  0.002980  0.024709  0.875094
+      A     G      0.246009 -0.002980  0.024709  0.875094
+      G     A      0.143858 -0.002980  0.024709  0.875094
+      G     G      0.538937  0.002980  0.024709  0.875094
+
+      MARKERS: tsc1612346 tsc0800273
+      D' = 0.133625
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.148160 -0.021175  1.706037  0.191500
+      A     T      0.063797  0.021175  1.706037  0.191500
+      G     C      0.650753  0.021175  1.706037  0.191500
+      G     T      0.137290 -0.021175  1.706037  0.191500
+
+      MARKERS: tsc0800273 tsc0988681
+      D' = 0.104754
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.684688  0.013725  0.892246  0.344869
+      C     T      0.117292 -0.013725  0.892246  0.344869
+      T     C      0.151945 -0.013725  0.892246  0.344869
+      T     T      0.046074  0.013725  0.892246  0.344869
+
+      MARKERS: tsc0988681 rs2695
+      D' = 0.717068
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.261946  0.031842  3.829788  0.050349
+      C     G      0.576289 -0.031842  3.829788  0.050349
+      T     A      0.012564 -0.031842  3.829788  0.050349
+      T     G      0.149201  0.031842  3.829788  0.050349
+
+      MARKERS: rs2695 tsc0927612
+      D' = 0.508069
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.264558  0.018869  1.598654  0.206094
+      A     T      0.018270 -0.018869  1.598654  0.206094
+      G     C      0.604128 -0.018869  1.598654  0.206094
+      G     T      0.113043  0.018869  1.598654  0.206094
+
+      MARKERS: tsc0927612 tsc0813195
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.186869  0.024538  3.626384  0.056870
+      C     T      0.681818 -0.024538  3.626384  0.056870
+      T     A      0.000000 -0.024538  3.626384  0.056870
+      T     T      0.131313  0.024538  3.626384  0.056870
+
+      MARKERS: tsc0813195 tsc0010190
+      D' = 0.88866
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.182361  0.006447  0.750669  0.386265
+      A     T      0.000808 -0.006447  0.750669  0.386265
+      T     C      0.778035 -0.006447  0.750669  0.386265
+      T     T      0.038796  0.006447  0.750669  0.386265
+
+      MARKERS: tsc0010190 tsc0717625
+      D' = 0.174117
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.040990 -0.006554  2.471540  0.115924
+      C     T      0.919406  0.006554  2.471540  0.115924
+      T     C      0.008515  0.006554  2.471540  0.115924
+      T     T      0.031089 -0.006554  2.471540  0.115924
+
+      MARKERS: tsc0717625 rs594689
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.000000 -0.023037  4.667200  0.030744
+      C     G      0.049505  0.023037  4.667200  0.030744
+      T     A      0.465347  0.023037  4.667200  0.030744
+      T     G      0.485149 -0.023037  4.667200  0.030744
+
+      MARKERS: rs594689 rs1042602
+      D' = 0.0935259
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.140594 -0.014506  0.392157  0.531168
+      A     C      0.329406  0.014506  0.392157  0.531168
+      G     A      0.189406  0.014506  0.392157  0.531168
+      G     C      0.340594 -0.014506  0.392157  0.531168
+
+      MARKERS: rs1042602 rs1800498
+      D' = 0.0357976
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.134347  0.007013  0.095420  0.757397
+      A     T      0.188886 -0.007013  0.095420  0.757397
+      C     C      0.259593 -0.007013  0.095420  0.757397
+      C     T      0.417175  0.007013  0.095420  0.757397
+
+      MARKERS: rs1800498 rs1079598
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.154639  0.094856 29.625307  0.000000
+      C     T      0.231959 -0.094856 29.625307  0.000000
+      T     C      0.000000 -0.094856 29.625307  0.000000
+      T     T      0.613402  0.094856 29.625307  0.000000
+
+      MARKERS: rs1079598 tsc0039147
+      D' = 0.0217878
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.128966 -0.002408  0.040355  0.840788
+      C     T      0.022075  0.002408  0.040355  0.840788
+      T     C      0.740825  0.002408  0.040355  0.840788
+      T     T      0.108133 -0.002408  0.040355  0.840788
+
+      MARKERS: tsc0039147 tsc0055196
+      D' = 0.366315
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.041293  0.002143  0.098202  0.753998
+      C     C      0.828707 -0.002143  0.098202  0.753998
+      T     A      0.003707 -0.002143  0.098202  0.753998
+      T     C      0.126293  0.002143  0.098202  0.753998
+
+      MARKERS: tsc0055196 rs1800404
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.045000  0.011025  1.589298  0.207426
+      A     G      0.000000 -0.011025  1.589298  0.207426
+      C     A      0.710000 -0.011025  1.589298  0.207426
+      C     G      0.245000  0.011025  1.589298  0.207426
+
+      MARKERS: rs1800404 rs2862
+      D' = 0.186256
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.232183  0.013233  0.469756  0.493099
+      A     T      0.522817 -0.013233  0.469756  0.493099
+      G     C      0.057817 -0.013233  0.469756  0.493099
+      G     T      0.187183  0.013233  0.469756  0.493099
+
+      MARKERS: rs2862 tsc0055903
+      D' = 0.172367
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.237781 -0.015168  1.053090  0.304797
+      C     T      0.050879  0.015168  1.053090  0.304797
+      T     C      0.638508  0.015168  1.053090  0.304797
+      T     T      0.072832 -0.015168  1.053090  0.304797
+
+      MARKERS: tsc0055903 tsc0473031
+      D' = 0.39418
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.658012 -0.011313  0.646543  0.421351
+      C     T      0.222196  0.011313  0.646543  0.421351
+      T     C      0.102405  0.011313  0.646543  0.421351
+      T     T      0.017387 -0.011313  0.646543  0.421351
+
+      MARKERS: tsc0473031 rs4646
+      D' = 0.148526
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     G      0.561026 -0.008918  0.238647  0.625185
+      C     T      0.191449  0.008918  0.238647  0.625185
+      T     G      0.196400  0.008918  0.238647  0.625185
+      T     T      0.051125 -0.008918  0.238647  0.625185
+
+      MARKERS: rs4646 tsc1472708
+      D' = 0.168237
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     C      0.076356 -0.015444  1.262389  0.261199
+      G     G      0.688644  0.015444  1.262389  0.261199
+      T     C      0.043644  0.015444  1.262389  0.261199
+      T     G      0.191356 -0.015444  1.262389  0.261199
+
+      MARKERS: tsc1472708 rs2891
+      D' = 0.410829
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.036068 -0.025150  2.444859  0.117911
+      C     G      0.087643  0.025150  2.444859  0.117911
+      G     A      0.458778  0.025150  2.444859  0.117911
+      G     G      0.417511 -0.025150  2.444859  0.117911
+
+      MARKERS: rs2891 rs2816
+      D' = 0.224038
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.227813 -0.049571  4.060092  0.043908
+      A     T      0.261982  0.049571  4.060092  0.043908
+      G     C      0.338513  0.049571  4.060092  0.043908
+      G     T      0.171691 -0.049571  4.060092  0.043908
+
+      MARKERS: rs2816 tsc0051129
+      D' = 0.407947
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.104451  0.026463  2.381537  0.122777
+      C     G      0.441467 -0.026463  2.381537  0.122777
+      T     C      0.038406 -0.026463  2.381537  0.122777
+      T     G      0.415676  0.026463  2.381537  0.122777
+
+      MARKERS: tsc0051129 tsc0041150
+      D' = 0.515805
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.112276  0.013555  0.934333  0.333740
+      C     G      0.012724 -0.013555  0.934333  0.333740
+      G     A      0.677497 -0.013555  0.934333  0.333740
+      G     G      0.197503  0.013555  0.934333  0.333740
+
+      MARKERS: tsc0041150 tsc0549661
+      D' = 0.179984
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.238878  0.010977  0.363463  0.546589
+      A     T      0.550011 -0.010977  0.363463  0.546589
+      G     C      0.050011 -0.010977  0.363463  0.546589
+      G     T      0.161100  0.010977  0.363463  0.546589
+
+      MARKERS: tsc0549661 rs4884
+      D' = 0.939799
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.051013 -0.165623 73.401452  0.000000
+      C     T      0.236865  0.165623 73.401452  0.000000
+      T     C      0.701512  0.165623 73.401452  0.000000
+      T     T      0.010609 -0.165623 73.401452  0.000000
+
+      MARKERS: rs4884 tsc0042022
+      D' = 0.731038
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.007156 -0.019449  6.252931  0.012399
+      C     G      0.745370  0.019449  6.252931  0.012399
+      T     A      0.028198  0.019449  6.252931  0.012399
+      T     G      0.219277 -0.019449  6.252931  0.012399
+
+POPULATION: 2
+
+   ALL  (N = 55)
+
+      MARKERS: rs140864 tsc1291477
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      D     A      0.000000 -0.014403  1.103628  0.293471
+      D     G      0.064815  0.014403  1.103628  0.293471
+      I     A      0.222222  0.014403  1.103628  0.293471
+      I     G      0.712963 -0.014403  1.103628  0.293471
+
+      MARKERS: tsc1291477 tsc0058017
+      D' = 0.4375
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.055556 -0.043210  2.438164  0.118415
+      A     G      0.166667  0.043210  2.438164  0.118415
+      G     A      0.388889  0.043210  2.438164  0.118415
+      G     G      0.388889 -0.043210  2.438164  0.118415
+
+      MARKERS: tsc0058017 tsc0268195
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.000000 -0.020576  2.173769  0.140382
+      A     T      0.444444  0.020576  2.173769  0.140382
+      G     G      0.046296  0.020576  2.173769  0.140382
+      G     T      0.509259 -0.020576  2.173769  0.140382
+
+      MARKERS: tsc0268195 rs2814778
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.045455  0.013223  1.074581  0.299913
+      G     G      0.000000 -0.013223  1.074581  0.299913
+      T     A      0.663636 -0.013223  1.074581  0.299913
+      T     G      0.290909  0.013223  1.074581  0.299913
+
+      MARKERS: rs2814778 tsc0053865
+      D' = 0.0160967
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.506130  0.003320  0.014251  0.904978
+      A     T      0.202961 -0.003320  0.014251  0.904978
+      G     A      0.202961 -0.003320  0.014251  0.904978
+      G     T      0.087949  0.003320  0.014251  0.904978
+
+      MARKERS: tsc0053865 tsc0057526
+      D' = 0.211143
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.361992 -0.027497  0.813347  0.367133
+      A     C      0.350971  0.027497  0.813347  0.367133
+      T     A      0.184304  0.027497  0.813347  0.367133
+      T     C      0.102733 -0.027497  0.813347  0.367133
+
+      MARKERS: tsc0057526 rs6003
+      D' = 0.260152
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.160922 -0.056585  2.984051  0.084089
+      A     G      0.385374  0.056585  2.984051  0.084089
+      C     A      0.237226  0.056585  2.984051  0.084089
+      C     G      0.216477 -0.056585  2.984051  0.084089
+
+      MARKERS: rs6003 rs2065160
+      D' = 0.0468095
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.073140  0.004908  0.038874  0.843699
+      A     T      0.321091 -0.004908  0.038874  0.843699
+      G     C      0.099937 -0.004908  0.038874  0.843699
+      G     T      0.505832  0.004908  0.038874  0.843699
+
+      MARKERS: rs2065160 tsc0755351
+      D' = 0.00170338
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.038506  0.000230  0.000115  0.991430
+      C     G      0.134571 -0.000230  0.000115  0.991430
+      T     A      0.182648 -0.000230  0.000115  0.991430
+      T     G      0.644275  0.000230  0.000115  0.991430
+
+      MARKERS: tsc0755351 rs2752
+      D' = 0.137514
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.086495  0.022445  0.779551  0.377279
+      A     T      0.140778 -0.022445  0.779551  0.377279
+      G     G      0.195323 -0.022445  0.779551  0.377279
+      G     T      0.577404  0.022445  0.779551  0.377279
+
+      MARKERS: rs2752 tsc0376342
+      D' = 0.558411
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.232156 -0.029167  3.427748  0.064109
+      G     C      0.049662  0.029167  3.427748  0.064109
+      T     A      0.695117  0.029167  3.427748  0.064109
+      T     C      0.023065 -0.029167  3.427748  0.064109
+
+      MARKERS: tsc0376342 rs17203
+      D' = 0.448388
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.386248 -0.018380  1.120205  0.289874
+      A     G      0.541025  0.018380  1.120205  0.289874
+      C     C      0.050116  0.018380  1.120205  0.289874
+      C     G      0.022612 -0.018380  1.120205  0.289874
+
+      MARKERS: rs17203 tsc0075980
+      D' = 0.396144
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.410014  0.017286  0.742465  0.388872
+      C     T      0.026350 -0.017286  0.742465  0.388872
+      G     A      0.489986 -0.017286  0.742465  0.388872
+      G     T      0.073650  0.017286  0.742465  0.388872
+
+      MARKERS: tsc0075980 tsc0380878
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.272727  0.027273  2.291652  0.130071
+      A     T      0.627273 -0.027273  2.291652  0.130071
+      T     C      0.000000 -0.027273  2.291652  0.130071
+      T     T      0.100000  0.027273  2.291652  0.130071
+
+      MARKERS: tsc0380878 tsc1365914
+      D' = 0.476118
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.079454 -0.072210  5.882232  0.015294
+      C     C      0.189065  0.072210  5.882232  0.015294
+      T     A      0.485361  0.072210  5.882232  0.015294
+      T     C      0.246120 -0.072210  5.882232  0.015294
+
+      MARKERS: tsc1365914 tsc0357650
+      D' = 0.00975284
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.158072  0.001179  0.001537  0.968731
+      A     T      0.406743 -0.001179  0.001537  0.968731
+      C     C      0.119706 -0.001179  0.001537  0.968731
+      C     T      0.315479  0.001179  0.001537  0.968731
+
+      MARKERS: tsc0357650 tsc0043383
+      D' = 0.0722279
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.184299 -0.014348  0.256765  0.612351
+      C     G      0.108153  0.014348  0.256765  0.612351
+      T     A      0.494946  0.014348  0.256765  0.612351
+      T     G      0.212601 -0.014348  0.256765  0.612351
+
+      MARKERS: tsc0043383 rs3309
+      D' = 0.0423597
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.437922  0.008588  0.081361  0.775461
+      A     T      0.241323 -0.008588  0.081361  0.775461
+      G     A      0.194153 -0.008588  0.081361  0.775461
+      G     T      0.126602  0.008588  0.081361  0.775461
+
+      MARKERS: rs3309 rs3317
+      D' = 0.065702
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.115127 -0.008096  0.101986  0.749460
+      A     G      0.530327  0.008096  0.101986  0.749460
+      T     A      0.075782  0.008096  0.101986  0.749460
+      T     G      0.278763 -0.008096  0.101986  0.749460
+
+      MARKERS: rs3317 tsc0696884
+      D' = 0.241785
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.110253  0.028018  1.151237  0.283290
+      A     T      0.087860 -0.028018  1.151237  0.283290
+      G     A      0.304841 -0.028018  1.151237  0.283290
+      G     T      0.497046  0.028018  1.151237  0.283290
+
+      MARKERS: tsc0696884 rs3340
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.415094  0.031328  3.296655  0.069421
+      A     G      0.000000 -0.031328  3.296655  0.069421
+      T     A      0.509434 -0.031328  3.296655  0.069421
+      T     G      0.075472  0.031328  3.296655  0.069421
+
+      MARKERS: rs3340 rs2763
+      D' = 0.00416867
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.131928 -0.000236  0.000375  0.984551
+      A     G      0.802034  0.000236  0.000375  0.984551
+      G     C      0.009581  0.000236  0.000375  0.984551
+      G     G      0.056456 -0.000236  0.000375  0.984551
+
+      MARKERS: rs2763 rs2161
+      D' = 0.367503
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.096757  0.026003  1.224834  0.268414
+      C     G      0.044752 -0.026003  1.224834  0.268414
+      G     A      0.403243 -0.026003  1.224834  0.268414
+      G     G      0.455248  0.026003  1.224834  0.268414
+
+      MARKERS: rs2161 tsc1612346
+      D' = 0.0955505
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.417980  0.011899  0.173484  0.677034
+      A     G      0.112632 -0.011899  0.173484  0.677034
+      G     A      0.347326 -0.011899  0.173484  0.677034
+      G     G      0.122061  0.011899  0.173484  0.677034
+
+      MARKERS: tsc1612346 tsc0800273
+      D' = 0.20851
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.666411  0.026053  1.590694  0.207227
+      A     T      0.098895 -0.026053  1.590694  0.207227
+      G     C      0.170324 -0.026053  1.590694  0.207227
+      G     T      0.064370  0.026053  1.590694  0.207227
+
+      MARKERS: tsc0800273 tsc0988681
+      D' = 0.0694285
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.317007 -0.006381  0.072772  0.787343
+      C     T      0.534845  0.006381  0.072772  0.787343
+      T     C      0.062622  0.006381  0.072772  0.787343
+      T     T      0.085526 -0.006381  0.072772  0.787343
+
+      MARKERS: tsc0988681 rs2695
+      D' = 0.348593
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.041195 -0.022045  0.805057  0.369586
+      C     G      0.324190  0.022045  0.805057  0.369586
+      T     A      0.131882  0.022045  0.805057  0.369586
+      T     G      0.502733 -0.022045  0.805057  0.369586
+
+      MARKERS: rs2695 tsc0927612
+      D' = 0.190476
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.117647 -0.027682  2.032058  0.154012
+      A     T      0.058824  0.027682  2.032058  0.154012
+      G     C      0.705882  0.027682  2.032058  0.154012
+      G     T      0.117647 -0.027682  2.032058  0.154012
+
+      MARKERS: tsc0927612 tsc0813195
+      D' = 0.122884
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.397538  0.010390  0.161906  0.687407
+      C     T      0.423216 -0.010390  0.161906  0.687407
+      T     A      0.074160 -0.010390  0.161906  0.687407
+      T     T      0.105085  0.010390  0.161906  0.687407
+
+      MARKERS: tsc0813195 tsc0010190
+      D' = 0.442275
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.079566 -0.063095  4.213016  0.040115
+      A     T      0.401916  0.063095  4.213016  0.040115
+      T     C      0.216731  0.063095  4.213016  0.040115
+      T     T      0.301788 -0.063095  4.213016  0.040115
+
+      MARKERS: tsc0010190 tsc0717625
+      D' = 0.573054
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.080252 -0.107715 12.878118  0.000332
+      C     T      0.221635  0.107715 12.878118  0.000332
+      T     C      0.542390  0.107715 12.878118  0.000332
+      T     T      0.155724 -0.107715 12.878118  0.000332
+
+      MARKERS: tsc0717625 rs594689
+      D' = 0.0843455
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.137129  0.006985  0.068287  0.793847
+      C     G      0.473982 -0.006985  0.068287  0.793847
+      T     A      0.075834 -0.006985  0.068287  0.793847
+      T     G      0.313055  0.006985  0.068287  0.793847
+
+      MARKERS: rs594689 rs1042602
+      D' = 0.321824
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.025289  0.013884  1.243013  0.264891
+      A     C      0.183802 -0.013884  1.243013  0.264891
+      G     A      0.029257 -0.013884  1.243013  0.264891
+      G     C      0.761652  0.013884  1.243013  0.264891
+
+      MARKERS: rs1042602 rs1800498
+      D' = 0.321824
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.029257 -0.013884  1.243013  0.264891
+      A     T      0.025289  0.013884  1.243013  0.264891
+      C     C      0.761652  0.013884  1.243013  0.264891
+      C     T      0.183802 -0.013884  1.243013  0.264891
+
+      MARKERS: rs1800498 rs1079598
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.122642  0.024297  1.824712  0.176753
+      C     T      0.679245 -0.024297  1.824712  0.176753
+      T     C      0.000000 -0.024297  1.824712  0.176753
+      T     T      0.198113  0.024297  1.824712  0.176753
+
+      MARKERS: rs1079598 tsc0039147
+      D' = 0.0649126
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.049073  0.005107  0.056483  0.812143
+      C     T      0.073569 -0.005107  0.056483  0.812143
+      T     C      0.309418 -0.005107  0.056483  0.812143
+      T     T      0.567941  0.005107  0.056483  0.812143
+
+      MARKERS: tsc0039147 tsc0055196
+      D' = 0.214698
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.189696 -0.049330  2.431637  0.118909
+      C     C      0.189934  0.049330  2.431637  0.118909
+      T     A      0.439934  0.049330  2.431637  0.118909
+      T     C      0.180436 -0.049330  2.431637  0.118909
+
+      MARKERS: tsc0055196 rs1800404
+      D' = 0.0745989
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.198117  0.007884  0.071200  0.789598
+      A     G      0.444740 -0.007884  0.071200  0.789598
+      C     A      0.097801 -0.007884  0.071200  0.789598
+      C     G      0.259342  0.007884  0.071200  0.789598
+
+      MARKERS: rs1800404 rs2862
+      D' = 0.198174
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.069759 -0.017241  0.378109  0.538617
+      A     T      0.220241  0.017241  0.378109  0.538617
+      G     C      0.230241  0.017241  0.378109  0.538617
+      G     T      0.479759 -0.017241  0.378109  0.538617
+
+      MARKERS: rs2862 tsc0055903
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.000000 -0.056960  5.550880  0.018471
+      C     T      0.301887  0.056960  5.550880  0.018471
+      T     C      0.188679  0.056960  5.550880  0.018471
+      T     T      0.509434 -0.056960  5.550880  0.018471
+
+      MARKERS: tsc0055903 tsc0473031
+      D' = 0.33744
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.075986  0.044551  5.376642  0.020408
+      C     T      0.116322 -0.044551  5.376642  0.020408
+      T     C      0.087476 -0.044551  5.376642  0.020408
+      T     T      0.720217  0.044551  5.376642  0.020408
+
+      MARKERS: tsc0473031 rs4646
+      D' = 0.691491
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     G      0.143468  0.031243  1.962243  0.161274
+      C     T      0.013939 -0.031243  1.962243  0.161274
+      T     G      0.569495 -0.031243  1.962243  0.161274
+      T     T      0.273098  0.031243  1.962243  0.161274
+
+      MARKERS: rs4646 tsc1472708
+      D' = 0.357024
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     C      0.450424 -0.033047  1.342211  0.246644
+      G     G      0.258667  0.033047  1.342211  0.246644
+      T     C      0.231394  0.033047  1.342211  0.246644
+      T     G      0.059515 -0.033047  1.342211  0.246644
+
+      MARKERS: tsc1472708 rs2891
+      D' = 0.240661
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.609640  0.024288  1.192328  0.274861
+      C     G      0.076635 -0.024288  1.192328  0.274861
+      G     A      0.243301 -0.024288  1.192328  0.274861
+      G     G      0.070424  0.024288  1.192328  0.274861
+
+      MARKERS: rs2891 rs2816
+      D' = 0.377985
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.780122  0.044251  7.290772  0.006931
+      A     T      0.072819 -0.044251  7.290772  0.006931
+      G     C      0.082623 -0.044251  7.290772  0.006931
+      G     T      0.064435  0.044251  7.290772  0.006931
+
+      MARKERS: rs2816 tsc0051129
+      D' = 0.0735248
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.611564  0.007018  0.109543  0.740665
+      C     G      0.252073 -0.007018  0.109543  0.740665
+      T     C      0.088436 -0.007018  0.109543  0.740665
+      T     G      0.047927  0.007018  0.109543  0.740665
+
+      MARKERS: tsc0051129 tsc0041150
+      D' = 0.465466
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.548674 -0.024243  1.108261  0.292460
+      C     G      0.138826  0.024243  1.108261  0.292460
+      G     A      0.284660  0.024243  1.108261  0.292460
+      G     G      0.027840 -0.024243  1.108261  0.292460
+
+      MARKERS: tsc0041150 tsc0549661
+      D' = 0.0580211
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.177708 -0.007670  0.143604  0.704724
+      A     T      0.652079  0.007670  0.143604  0.704724
+      G     C      0.045696  0.007670  0.143604  0.704724
+      G     T      0.124517 -0.007670  0.143604  0.704724
+
+      MARKERS: tsc0549661 rs4884
+      D' = 0.814837
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.029729 -0.130826 32.622521  0.000000
+      C     T      0.177818  0.130826 32.622521  0.000000
+      T     C      0.743856  0.130826 32.622521  0.000000
+      T     T      0.048597 -0.130826 32.622521  0.000000
+
+      MARKERS: rs4884 tsc0042022
+      D' = 0.0548956
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.564219  0.009178  0.131285  0.717103
+      C     G      0.204300 -0.009178  0.131285  0.717103
+      T     A      0.158004 -0.009178  0.131285  0.717103
+      T     G      0.073478  0.009178  0.131285  0.717103
+
+   UNAFFECTED  (N = 27)
+
+      MARKERS: rs140864 tsc1291477
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      D     A      0.000000 -0.013717  0.490924  0.483515
+      D     G      0.074074  0.013717  0.490924  0.483515
+      I     A      0.185185  0.013717  0.490924  0.483515
+      I     G      0.740741 -0.013717  0.490924  0.483515
+
+      MARKERS: tsc1291477 tsc0058017
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.000000 -0.085059  5.248226  0.021969
+      A     G      0.192308  0.085059  5.248226  0.021969
+      G     A      0.442308  0.085059  5.248226  0.021969
+      G     G      0.365385 -0.085059  5.248226  0.021969
+
+      MARKERS: tsc0058017 tsc0268195
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.000000 -0.017012  0.888111  0.345990
+      A     T      0.442308  0.017012  0.888111  0.345990
+      G     G      0.038462  0.017012  0.888111  0.345990
+      G     T      0.519231 -0.017012  0.888111  0.345990
+
+      MARKERS: tsc0268195 rs2814778
+      D' = 0.36074
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.030460  0.003711  0.051972  0.819667
+      G     G      0.006577 -0.003711  0.051972  0.819667
+      T     A      0.691762 -0.003711  0.051972  0.819667
+      T     G      0.271201  0.003711  0.051972  0.819667
+
+      MARKERS: rs2814778 tsc0053865
+      D' = 0.177939
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.557302  0.035698  0.854869  0.355178
+      A     T      0.164920 -0.035698  0.854869  0.355178
+      G     A      0.164920 -0.035698  0.854869  0.355178
+      G     T      0.112858  0.035698  0.854869  0.355178
+
+      MARKERS: tsc0053865 tsc0057526
+      D' = 0.0149297
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.452178  0.002474  0.003479  0.952965
+      A     C      0.278592 -0.002474  0.003479  0.952965
+      T     A      0.163207 -0.002474  0.003479  0.952965
+      T     C      0.106024  0.002474  0.003479  0.952965
+
+      MARKERS: tsc0057526 rs6003
+      D' = 0.241667
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.134615 -0.042899  1.046455  0.306325
+      A     G      0.480769  0.042899  1.046455  0.306325
+      C     A      0.153846  0.042899  1.046455  0.306325
+      C     G      0.230769 -0.042899  1.046455  0.306325
+
+      MARKERS: rs6003 rs2065160
+      D' = 0.131944
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.060000  0.015200  0.231356  0.630520
+      A     T      0.220000 -0.015200  0.231356  0.630520
+      G     C      0.100000 -0.015200  0.231356  0.630520
+      G     T      0.620000  0.015200  0.231356  0.630520
+
+      MARKERS: rs2065160 tsc0755351
+      D' = 0.0131579
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.040000  0.001600  0.002814  0.957697
+      C     G      0.120000 -0.001600  0.002814  0.957697
+      T     A      0.200000 -0.001600  0.002814  0.957697
+      T     G      0.640000  0.001600  0.002814  0.957697
+
+      MARKERS: tsc0755351 rs2752
+      D' = 0.256324
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.111439  0.044567  1.462424  0.226545
+      A     T      0.129302 -0.044567  1.462424  0.226545
+      G     G      0.166339 -0.044567  1.462424  0.226545
+      G     T      0.592920  0.044567  1.462424  0.226545
+
+      MARKERS: rs2752 tsc0376342
+      D' = 0.538462
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.240741 -0.021605  1.197189  0.273884
+      G     C      0.037037  0.021605  1.197189  0.273884
+      T     A      0.703704  0.021605  1.197189  0.273884
+      T     C      0.018519 -0.021605  1.197189  0.273884
+
+      MARKERS: tsc0376342 rs17203
+      D' = 0.333333
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.462963 -0.009259  0.176457  0.674436
+      A     G      0.481481  0.009259  0.176457  0.674436
+      C     C      0.037037  0.009259  0.176457  0.674436
+      C     G      0.018519 -0.009259  0.176457  0.674436
+
+      MARKERS: rs17203 tsc0075980
+      D' = 0.609153
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.478286  0.033842  1.252365  0.263101
+      C     T      0.021714 -0.033842  1.252365  0.263101
+      G     A      0.410603 -0.033842  1.252365  0.263101
+      G     T      0.089397  0.033842  1.252365  0.263101
+
+      MARKERS: tsc0075980 tsc0380878
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.351852  0.039095  1.832163  0.175872
+      A     T      0.537037 -0.039095  1.832163  0.175872
+      T     C      0.000000 -0.039095  1.832163  0.175872
+      T     T      0.111111  0.039095  1.832163  0.175872
+
+      MARKERS: tsc0380878 tsc1365914
+      D' = 0.407279
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.114423 -0.078624  2.967029  0.084978
+      C     C      0.231731  0.078624  2.967029  0.084978
+      T     A      0.443269  0.078624  2.967029  0.084978
+      T     C      0.210577 -0.078624  2.967029  0.084978
+
+      MARKERS: tsc1365914 tsc0357650
+      D' = 0.241473
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.217240  0.034917  0.600530  0.438376
+      A     T      0.340453 -0.034917  0.600530  0.438376
+      C     C      0.109684 -0.034917  0.600530  0.438376
+      C     T      0.332624  0.034917  0.600530  0.438376
+
+      MARKERS: tsc0357650 tsc0043383
+      D' = 6.60583e-16
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.240741 -0.000000  0.000000  1.000000
+      C     G      0.092593  0.000000  0.000000  1.000000
+      T     A      0.481481  0.000000  0.000000  1.000000
+      T     G      0.185185 -0.000000  0.000000  1.000000
+
+      MARKERS: tsc0043383 rs3309
+      D' = 0.0716985
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.508502  0.013646  0.116189  0.733205
+      A     T      0.213720 -0.013646  0.116189  0.733205
+      G     A      0.176683 -0.013646  0.116189  0.733205
+      G     T      0.101095  0.013646  0.116189  0.733205
+
+      MARKERS: rs3309 rs3317
+      D' = 0.436171
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.182777  0.030514  0.674317  0.411551
+      A     G      0.502408 -0.030514  0.674317  0.411551
+      T     A      0.039445 -0.030514  0.674317  0.411551
+      T     G      0.275370  0.030514  0.674317  0.411551
+
+      MARKERS: rs3317 tsc0696884
+      D' = 0.362221
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.151358  0.040247  1.012156  0.314387
+      A     T      0.070864 -0.040247  1.012156  0.314387
+      G     A      0.348642 -0.040247  1.012156  0.314387
+      G     T      0.429136  0.040247  1.012156  0.314387
+
+      MARKERS: tsc0696884 rs3340
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.500000  0.046296  2.755171  0.096940
+      A     G      0.000000 -0.046296  2.755171  0.096940
+      T     A      0.407407 -0.046296  2.755171  0.096940
+      T     G      0.092593  0.046296  2.755171  0.096940
+
+      MARKERS: rs3340 rs2763
+      D' = 0.252725
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.080023 -0.020800  1.407798  0.235422
+      A     G      0.827385  0.020800  1.407798  0.235422
+      G     C      0.031089  0.020800  1.407798  0.235422
+      G     G      0.061504 -0.020800  1.407798  0.235422
+
+      MARKERS: rs2763 rs2161
+      D' = 9.4369e-16
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.055556 -0.000000  0.000000  1.000000
+      C     G      0.055556  0.000000  0.000000  1.000000
+      G     A      0.444444  0.000000  0.000000  1.000000
+      G     G      0.444444 -0.000000  0.000000  1.000000
+
+      MARKERS: rs2161 tsc1612346
+      D' = 0.132454
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.346647 -0.017936  0.175943  0.674883
+      A     G      0.153353  0.017936  0.175943  0.674883
+      G     A      0.382520  0.017936  0.175943  0.674883
+      G     G      0.117480 -0.017936  0.175943  0.674883
+
+      MARKERS: tsc1612346 tsc0800273
+      D' = 0.0995729
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.592383  0.015126  0.207309  0.648885
+      A     T      0.136784 -0.015126  0.207309  0.648885
+      G     C      0.199284 -0.015126  0.207309  0.648885
+      G     T      0.071550  0.015126  0.207309  0.648885
+
+      MARKERS: tsc0800273 tsc0988681
+      D' = 0.160061
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.251694 -0.018646  0.282723  0.594922
+      C     T      0.575229  0.018646  0.282723  0.594922
+      T     C      0.075229  0.018646  0.282723  0.594922
+      T     T      0.097848 -0.018646  0.282723  0.594922
+
+      MARKERS: tsc0988681 rs2695
+      D' = 0.104361
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.076378  0.013508  0.148382  0.700086
+      C     G      0.250545 -0.013508  0.148382  0.700086
+      T     A      0.115930 -0.013508  0.148382  0.700086
+      T     G      0.557147  0.013508  0.148382  0.700086
+
+      MARKERS: rs2695 tsc0927612
+      D' = 0.396927
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.091442 -0.060185  3.885907  0.048693
+      A     T      0.100865  0.060185  3.885907  0.048693
+      G     C      0.697019  0.060185  3.885907  0.048693
+      G     T      0.110673 -0.060185  3.885907  0.048693
+
+      MARKERS: tsc0927612 tsc0813195
+      D' = 0.227375
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.434368  0.024974  0.404422  0.524815
+      C     T      0.354094 -0.024974  0.404422  0.524815
+      T     A      0.084863 -0.024974  0.404422  0.524815
+      T     T      0.126675  0.024974  0.404422  0.524815
+
+      MARKERS: tsc0813195 tsc0010190
+      D' = 0.411627
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.090395 -0.063240  2.074383  0.149791
+      A     T      0.428124  0.063240  2.074383  0.149791
+      T     C      0.205901  0.063240  2.074383  0.149791
+      T     T      0.275580 -0.063240  2.074383  0.149791
+
+      MARKERS: tsc0010190 tsc0717625
+      D' = 0.582396
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.074131 -0.103384  5.670378  0.017254
+      C     T      0.233561  0.103384  5.670378  0.017254
+      T     C      0.502792  0.103384  5.670378  0.017254
+      T     T      0.189516 -0.103384  5.670378  0.017254
+
+      MARKERS: tsc0717625 rs594689
+      D' = 0.0747693
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.102651 -0.008295  0.050446  0.822289
+      C     G      0.474272  0.008295  0.050446  0.822289
+      T     A      0.089656  0.008295  0.050446  0.822289
+      T     G      0.333421 -0.008295  0.050446  0.822289
+
+      MARKERS: rs594689 rs1042602
+      D' = 0.352891
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.052525  0.031949  1.849276  0.173868
+      A     C      0.132660 -0.031949  1.849276  0.173868
+      G     A      0.058586 -0.031949  1.849276  0.173868
+      G     C      0.756229  0.031949  1.849276  0.173868
+
+      MARKERS: rs1042602 rs1800498
+      D' = 0.352891
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.058586 -0.031949  1.849276  0.173868
+      A     T      0.052525  0.031949  1.849276  0.173868
+      C     C      0.756229  0.031949  1.849276  0.173868
+      C     T      0.132660 -0.031949  1.849276  0.173868
+
+      MARKERS: rs1800498 rs1079598
+      D' = 0.655152
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.145684  0.015507  0.330503  0.565363
+      C     T      0.700470 -0.015507  0.330503  0.565363
+      T     C      0.008162 -0.015507  0.330503  0.565363
+      T     T      0.145684  0.015507  0.330503  0.565363
+
+      MARKERS: rs1079598 tsc0039147
+      D' = 0.214474
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.034861 -0.009518  0.087108  0.767887
+      C     T      0.118986  0.009518  0.087108  0.767887
+      T     C      0.253601  0.009518  0.087108  0.767887
+      T     T      0.592553 -0.009518  0.087108  0.767887
+
+      MARKERS: tsc0039147 tsc0055196
+      D' = 0.287514
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.139124 -0.056142  1.701448  0.192099
+      C     C      0.168568  0.056142  1.701448  0.192099
+      T     A      0.495491  0.056142  1.701448  0.192099
+      T     C      0.196817 -0.056142  1.701448  0.192099
+
+      MARKERS: tsc0055196 rs1800404
+      D' = 0.228534
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.113022 -0.033481  0.791412  0.373674
+      A     G      0.560891  0.033481  0.791412  0.373674
+      C     A      0.104369  0.033481  0.791412  0.373674
+      C     G      0.221718 -0.033481  0.791412  0.373674
+
+      MARKERS: rs1800404 rs2862
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.000000 -0.065104  3.122483  0.077219
+      A     T      0.208333  0.065104  3.122483  0.077219
+      G     C      0.312500  0.065104  3.122483  0.077219
+      G     T      0.479167 -0.065104  3.122483  0.077219
+
+      MARKERS: rs2862 tsc0055903
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.000000 -0.054400  2.675328  0.101914
+      C     T      0.340000  0.054400  2.675328  0.101914
+      T     C      0.160000  0.054400  2.675328  0.101914
+      T     T      0.500000 -0.054400  2.675328  0.101914
+
+      MARKERS: tsc0055903 tsc0473031
+      D' = 0.66317
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.116886  0.084886  9.593133  0.001953
+      C     T      0.043114 -0.084886  9.593133  0.001953
+      T     C      0.083114 -0.084886  9.593133  0.001953
+      T     T      0.756886  0.084886  9.593133  0.001953
+
+      MARKERS: tsc0473031 rs4646
+      D' = 0.554805
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     G      0.162284  0.028539  0.726454  0.394035
+      C     T      0.022901 -0.028539  0.726454  0.394035
+      T     G      0.559938 -0.028539  0.726454  0.394035
+      T     T      0.254877  0.028539  0.726454  0.394035
+
+      MARKERS: rs4646 tsc1472708
+      D' = 0.41127
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     C      0.412421 -0.042312  1.033223  0.309403
+      G     G      0.309801  0.042312  1.033223  0.309403
+      T     C      0.217209  0.042312  1.033223  0.309403
+      T     G      0.060569 -0.042312  1.033223  0.309403
+
+      MARKERS: tsc1472708 rs2891
+      D' = 0.225806
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.604167  0.012153  0.223861  0.636113
+      C     G      0.041667 -0.012153  0.223861  0.636113
+      G     A      0.312500 -0.012153  0.223861  0.636113
+      G     G      0.041667  0.012153  0.223861  0.636113
+
+      MARKERS: rs2891 rs2816
+      D' = 0.399356
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.831203  0.029120  2.656530  0.103125
+      A     T      0.085464 -0.029120  2.656530  0.103125
+      G     C      0.043797 -0.029120  2.656530  0.103125
+      G     T      0.039536  0.029120  2.656530  0.103125
+
+      MARKERS: rs2816 tsc0051129
+      D' = 0.183048
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.629181  0.016698  0.320003  0.571606
+      C     G      0.241190 -0.016698  0.320003  0.571606
+      T     C      0.074523 -0.016698  0.320003  0.571606
+      T     G      0.055107  0.016698  0.320003  0.571606
+
+      MARKERS: tsc0051129 tsc0041150
+      D' = 0.316532
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.541008 -0.018992  0.291919  0.588994
+      C     G      0.158992  0.018992  0.291919  0.588994
+      G     A      0.258992  0.018992  0.291919  0.588994
+      G     G      0.041008 -0.018992  0.291919  0.588994
+
+      MARKERS: tsc0041150 tsc0549661
+      D' = 0.0969311
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.182771 -0.015145  0.218059  0.640523
+      A     T      0.608895  0.015145  0.218059  0.640523
+      G     C      0.067229  0.015145  0.218059  0.640523
+      G     T      0.141105 -0.015145  0.218059  0.640523
+
+      MARKERS: tsc0549661 rs4884
+      D' = 0.878009
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.039081 -0.142871 17.962981  0.000023
+      C     T      0.191688  0.142871 17.962981  0.000023
+      T     C      0.749380  0.142871 17.962981  0.000023
+      T     T      0.019851 -0.142871 17.962981  0.000023
+
+      MARKERS: rs4884 tsc0042022
+      D' = 0.128908
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.522682  0.018567  0.236143  0.627006
+      C     G      0.255096 -0.018567  0.236143  0.627006
+      T     A      0.125466 -0.018567  0.236143  0.627006
+      T     G      0.096756  0.018567  0.236143  0.627006
+
+   AFFECTED  (N = 28)
+
+      MARKERS: rs140864 tsc1291477
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      D     A      0.000000 -0.014403  0.590396  0.442266
+      D     G      0.055556  0.014403  0.590396  0.442266
+      I     A      0.259259  0.014403  0.590396  0.442266
+      I     G      0.685185 -0.014403  0.590396  0.442266
+
+      MARKERS: tsc1291477 tsc0058017
+      D' = 0.218605
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.141860  0.030253  0.553067  0.457067
+      A     G      0.108140 -0.030253  0.553067  0.457067
+      G     A      0.304568 -0.030253  0.553067  0.457067
+      G     G      0.445432  0.030253  0.553067  0.457067
+
+      MARKERS: tsc0058017 tsc0268195
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.000000 -0.023916  1.278181  0.258238
+      A     T      0.446429  0.023916  1.278181  0.258238
+      G     G      0.053571  0.023916  1.278181  0.258238
+      G     T      0.500000 -0.023916  1.278181  0.258238
+
+      MARKERS: tsc0268195 rs2814778
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.053571  0.016263  0.690876  0.405867
+      G     G      0.000000 -0.016263  0.690876  0.405867
+      T     A      0.642857 -0.016263  0.690876  0.405867
+      T     G      0.303571  0.016263  0.690876  0.405867
+
+      MARKERS: rs2814778 tsc0053865
+      D' = 0.586497
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.430964 -0.054049  1.830039  0.176123
+      A     T      0.265465  0.054049  1.830039  0.176123
+      G     A      0.265465  0.054049  1.830039  0.176123
+      G     T      0.038107 -0.054049  1.830039  0.176123
+
+      MARKERS: tsc0053865 tsc0057526
+      D' = 0.377937
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.276364 -0.059414  1.872481  0.171191
+      A     C      0.420065  0.059414  1.872481  0.171191
+      T     A      0.205779  0.059414  1.872481  0.171191
+      T     C      0.097792 -0.059414  1.872481  0.171191
+
+      MARKERS: tsc0057526 rs6003
+      D' = 0.22498
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.186835 -0.054236  1.319508  0.250680
+      A     G      0.295308  0.054236  1.319508  0.250680
+      C     A      0.313165  0.054236  1.319508  0.250680
+      C     G      0.204692 -0.054236  1.319508  0.250680
+
+      MARKERS: rs6003 rs2065160
+      D' = 0.157756
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.077986 -0.014607  0.158369  0.690663
+      A     T      0.422014  0.014607  0.158369  0.690663
+      G     C      0.107200  0.014607  0.158369  0.690663
+      G     T      0.392800 -0.014607  0.158369  0.690663
+
+      MARKERS: rs2065160 tsc0755351
+      D' = 0.0293969
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.036614 -0.001109  0.001355  0.970633
+      C     G      0.148571  0.001109  0.001355  0.970633
+      T     A      0.167090  0.001109  0.001355  0.970633
+      T     G      0.647725 -0.001109  0.001355  0.970633
+
+      MARKERS: tsc0755351 rs2752
+      D' = 0.0135912
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     G      0.063305  0.002080  0.003526  0.952646
+      A     T      0.150981 -0.002080  0.003526  0.952646
+      G     G      0.222410 -0.002080  0.003526  0.952646
+      G     T      0.563305  0.002080  0.003526  0.952646
+
+      MARKERS: rs2752 tsc0376342
+      D' = 0.585823
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     A      0.222843 -0.037361  2.355137  0.124871
+      G     C      0.062871  0.037361  2.355137  0.124871
+      T     A      0.687871  0.037361  2.355137  0.124871
+      T     C      0.026414 -0.037361  2.355137  0.124871
+
+      MARKERS: tsc0376342 rs17203
+      D' = 0.581463
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.309070 -0.032448  1.546791  0.213610
+      A     G      0.601644  0.032448  1.546791  0.213610
+      C     C      0.065930  0.032448  1.546791  0.213610
+      C     G      0.023356 -0.032448  1.546791  0.213610
+
+      MARKERS: rs17203 tsc0075980
+      D' = 0.0737912
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.337400 -0.004118  0.024911  0.874588
+      C     T      0.037600  0.004118  0.024911  0.874588
+      G     A      0.573314  0.004118  0.024911  0.874588
+      G     T      0.051686 -0.004118  0.024911  0.874588
+
+      MARKERS: tsc0075980 tsc0380878
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.196429  0.017538  0.670991  0.412706
+      A     T      0.714286 -0.017538  0.670991  0.412706
+      T     C      0.000000 -0.017538  0.670991  0.412706
+      T     T      0.089286  0.017538  0.670991  0.412706
+
+      MARKERS: tsc0380878 tsc1365914
+      D' = 0.594371
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.045530 -0.066715  3.223960  0.072568
+      C     C      0.150899  0.066715  3.223960  0.072568
+      T     A      0.525899  0.066715  3.223960  0.072568
+      T     C      0.277673 -0.066715  3.223960  0.072568
+
+      MARKERS: tsc1365914 tsc0357650
+      D' = 0.361257
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.084731 -0.047922  1.473016  0.224870
+      A     T      0.486697  0.047922  1.473016  0.224870
+      C     C      0.147412  0.047922  1.473016  0.224870
+      C     T      0.281160 -0.047922  1.473016  0.224870
+
+      MARKERS: tsc0357650 tsc0043383
+      D' = 0.253498
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.118435 -0.040218  1.095766  0.295197
+      C     G      0.131565  0.040218  1.095766  0.295197
+      T     A      0.516180  0.040218  1.095766  0.295197
+      T     G      0.233820 -0.040218  1.095766  0.295197
+
+      MARKERS: tsc0043383 rs3309
+      D' = 0.00724857
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.365004 -0.001121  0.000636  0.979886
+      A     T      0.269612  0.001121  0.000636  0.979886
+      G     A      0.211919  0.001121  0.000636  0.979886
+      G     T      0.153465 -0.001121  0.000636  0.979886
+
+      MARKERS: rs3309 rs3317
+      D' = 0.356638
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.062777 -0.034799  1.053953  0.304598
+      A     G      0.544366  0.034799  1.053953  0.304598
+      T     A      0.097937  0.034799  1.053953  0.304598
+      T     G      0.294920 -0.034799  1.053953  0.304598
+
+      MARKERS: rs3317 tsc0696884
+      D' = 0.107724
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.069132  0.012549  0.148569  0.699907
+      A     T      0.103945 -0.012549  0.148569  0.699907
+      G     A      0.257791 -0.012549  0.148569  0.699907
+      G     T      0.569132  0.012549  0.148569  0.699907
+
+      MARKERS: tsc0696884 rs3340
+      D' = 0.0445442
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.306332 -0.001730  0.007509  0.930946
+      A     G      0.020591  0.001730  0.007509  0.930946
+      T     A      0.635975  0.001730  0.007509  0.930946
+      T     G      0.037102 -0.001730  0.007509  0.930946
+
+      MARKERS: rs3340 rs2763
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.173077  0.006657  0.170989  0.679234
+      A     G      0.788462 -0.006657  0.170989  0.679234
+      G     C      0.000000 -0.006657  0.170989  0.679234
+      G     G      0.038462  0.006657  0.170989  0.679234
+
+      MARKERS: rs2763 rs2161
+      D' = 0.449144
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.125407  0.038868  1.183725  0.276599
+      C     G      0.047670 -0.038868  1.183725  0.276599
+      G     A      0.374593 -0.038868  1.183725  0.276599
+      G     G      0.452330  0.038868  1.183725  0.276599
+
+      MARKERS: rs2161 tsc1612346
+      D' = 0.306226
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.482297  0.034297  0.824468  0.363877
+      A     G      0.077703 -0.034297  0.824468  0.363877
+      G     A      0.317703 -0.034297  0.824468  0.363877
+      G     G      0.122297  0.034297  0.824468  0.363877
+
+      MARKERS: tsc1612346 tsc0800273
+      D' = 0.286394
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.731494  0.027494  1.209458  0.271440
+      A     T      0.068506 -0.027494  1.209458  0.271440
+      G     C      0.148506 -0.027494  1.209458  0.271440
+      G     T      0.051494  0.027494  1.209458  0.271440
+
+      MARKERS: tsc0800273 tsc0988681
+      D' = 9.28251e-15
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.375000 -0.000000  0.000000  1.000000
+      C     T      0.500000  0.000000  0.000000  1.000000
+      T     C      0.053571  0.000000  0.000000  1.000000
+      T     T      0.071429 -0.000000  0.000000  1.000000
+
+      MARKERS: tsc0988681 rs2695
+      D' = 0.558599
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.027424 -0.034706  1.057873  0.303701
+      C     G      0.376422  0.034706  1.057873  0.303701
+      T     A      0.126422  0.034706  1.057873  0.303701
+      T     G      0.469732 -0.034706  1.057873  0.303701
+
+      MARKERS: rs2695 tsc0927612
+      D' = 0.357006
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.145597  0.007997  0.108992  0.741294
+      A     T      0.014403 -0.007997  0.108992  0.741294
+      G     C      0.714403 -0.007997  0.108992  0.741294
+      G     T      0.125597  0.007997  0.108992  0.741294
+
+      MARKERS: tsc0927612 tsc0813195
+      D' = 0.0777916
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.356210 -0.006616  0.039655  0.842156
+      C     T      0.495642  0.006616  0.039655  0.842156
+      T     A      0.069716  0.006616  0.039655  0.842156
+      T     T      0.078432 -0.006616  0.039655  0.842156
+
+      MARKERS: tsc0813195 tsc0010190
+      D' = 0.492907
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.066778 -0.064910  2.310313  0.128518
+      A     T      0.377667  0.064910  2.310313  0.128518
+      T     C      0.229519  0.064910  2.310313  0.128518
+      T     T      0.326037 -0.064910  2.310313  0.128518
+
+      MARKERS: tsc0010190 tsc0717625
+      D' = 0.56542
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.085843 -0.111688  7.296197  0.006910
+      C     T      0.210453  0.111688  7.296197  0.006910
+      T     C      0.580824  0.111688  7.296197  0.006910
+      T     T      0.122880 -0.111688  7.296197  0.006910
+
+      MARKERS: tsc0717625 rs594689
+      D' = 0.251323
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.170071  0.020837  0.297049  0.585738
+      C     G      0.472786 -0.020837  0.297049  0.585738
+      T     A      0.062071 -0.020837  0.297049  0.585738
+      T     G      0.295071  0.020837  0.297049  0.585738
+
+      MARKERS: rs594689 rs1042602
+      D' = 0
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.000000  0.000000   ******    ******
+      A     C      0.232143  0.000000   ******    ******
+      G     A      0.000000  0.000000   ******    ******
+      G     C      0.767857  0.000000   ******    ******
+
+      MARKERS: rs1042602 rs1800498
+      D' = 0
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.000000  0.000000   ******    ******
+      A     T      0.000000  0.000000   ******    ******
+      C     C      0.767857  0.000000   ******    ******
+      C     T      0.232143  0.000000   ******    ******
+
+      MARKERS: rs1800498 rs1079598
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.092593  0.022291  0.928988  0.335126
+      C     T      0.666667 -0.022291  0.928988  0.335126
+      T     C      0.000000 -0.022291  0.928988  0.335126
+      T     T      0.240741  0.022291  0.928988  0.335126
+
+      MARKERS: rs1079598 tsc0039147
+      D' = 0.508928
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.066490  0.027052  0.986881  0.320506
+      C     T      0.026103 -0.027052  0.986881  0.320506
+      T     C      0.359436 -0.027052  0.986881  0.320506
+      T     T      0.547971  0.027052  0.986881  0.320506
+
+      MARKERS: tsc0039147 tsc0055196
+      D' = 0.20115
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.237261 -0.041757  0.842893  0.358571
+      C     C      0.209167  0.041757  0.842893  0.358571
+      T     A      0.387739  0.041757  0.842893  0.358571
+      T     C      0.165833 -0.041757  0.842893  0.358571
+
+      MARKERS: tsc0055196 rs1800404
+      D' = 0.369301
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     A      0.276751  0.051899  1.387725  0.238790
+      A     G      0.338634 -0.051899  1.387725  0.238790
+      C     A      0.088634 -0.051899  1.387725  0.238790
+      C     G      0.295982  0.051899  1.387725  0.238790
+
+      MARKERS: rs1800404 rs2862
+      D' = 0.130626
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.129312  0.023913  0.352091  0.552932
+      A     T      0.236072 -0.023913  0.352091  0.552932
+      G     C      0.159149 -0.023913  0.352091  0.552932
+      G     T      0.475466  0.023913  0.352091  0.552932
+
+      MARKERS: rs2862 tsc0055903
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.000000 -0.057398  2.793732  0.094634
+      C     T      0.267857  0.057398  2.793732  0.094634
+      T     C      0.214286  0.057398  2.793732  0.094634
+      T     T      0.517857 -0.057398  2.793732  0.094634
+
+      MARKERS: tsc0055903 tsc0473031
+      D' = 0.138964
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.024804 -0.004003  0.023619  0.877857
+      C     T      0.197419  0.004003  0.023619  0.877857
+      T     C      0.104826  0.004003  0.023619  0.877857
+      T     T      0.672952 -0.004003  0.023619  0.877857
+
+      MARKERS: tsc0473031 rs4646
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     G      0.129630  0.038409  1.731702  0.188194
+      C     T      0.000000 -0.038409  1.731702  0.188194
+      T     G      0.574074 -0.038409  1.731702  0.188194
+      T     T      0.296296  0.038409  1.731702  0.188194
+
+      MARKERS: rs4646 tsc1472708
+      D' = 0.21893
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      G     C      0.492083 -0.017802  0.214023  0.643632
+      G     G      0.204345  0.017802  0.214023  0.643632
+      T     C      0.240060  0.017802  0.214023  0.643632
+      T     G      0.063512 -0.017802  0.214023  0.643632
+
+      MARKERS: tsc1472708 rs2891
+      D' = 0.350956
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.626735  0.051632  2.346564  0.125559
+      C     G      0.095487 -0.051632  2.346564  0.125559
+      G     A      0.169561 -0.051632  2.346564  0.125559
+      G     G      0.108217  0.051632  2.346564  0.125559
+
+      MARKERS: rs2891 rs2816
+      D' = 0.481831
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.735168  0.056842  4.554695  0.032829
+      A     T      0.061128 -0.056842  4.554695  0.032829
+      G     C      0.116684 -0.056842  4.554695  0.032829
+      G     T      0.087020  0.056842  4.554695  0.032829
+
+      MARKERS: rs2816 tsc0051129
+      D' = 0.0154652
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.598477  0.001539  0.002561  0.959643
+      C     G      0.258665 -0.001539  0.002561  0.959643
+      T     C      0.097951 -0.001539  0.002561  0.959643
+      T     G      0.044906  0.001539  0.002561  0.959643
+
+      MARKERS: tsc0051129 tsc0041150
+      D' = 1
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.543478 -0.042533  2.112484  0.146102
+      C     G      0.130435  0.042533  2.112484  0.146102
+      G     A      0.326087  0.042533  2.112484  0.146102
+      G     G      0.000000 -0.042533  2.112484  0.146102
+
+      MARKERS: tsc0041150 tsc0549661
+      D' = 0.547557
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      A     C      0.184106  0.013974  0.328633  0.566465
+      A     T      0.685459 -0.013974  0.328633  0.566465
+      G     C      0.011546 -0.013974  0.328633  0.566465
+      G     T      0.118889  0.013974  0.328633  0.566465
+
+      MARKERS: tsc0549661 rs4884
+      D' = 0.855072
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     C      0.020377 -0.120226 15.095192  0.000102
+      C     T      0.164808  0.120226 15.095192  0.000102
+      T     C      0.738882  0.120226 15.095192  0.000102
+      T     T      0.075933 -0.120226 15.095192  0.000102
+
+      MARKERS: rs4884 tsc0042022
+      D' = 0.381659
+      ALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL
+      C     A      0.585879 -0.018716  0.339966  0.559849
+      C     G      0.173380  0.018716  0.339966  0.559849
+      T     A      0.210417  0.018716  0.339966  0.559849
+      T     G      0.030323 -0.018716  0.339966  0.559849
@@ -0,0 +1,348 @@
+/*
+ * bitgeno.c
+ *
+ *
+ * Storage and counting for the bit-plane genotype matrix described in
+ * bitgeno.h.
+ *
+ *     gb_alloc(b, nmrk, nind, nseg, seg)
+ *                                    allocate the matrix, all untyped,
+ *                                    with individual i in segment seg[i]
+ *     gb_free(b)                     free the matrix
+ *     gb_set_marker(b, m, all1, all2)
+ *                                    set the planes of marker m from its
+ *                                    two rows of allele codes
+ *     gb_count(b, m1, a1, m2, a2, s, cnt)
+ *                                    count allele a1 (0 = first, 1 =
+ *                                    second) of marker m1 against allele
+ *                                    a2 of marker m2, over the
+ *                                    individuals of segment s
+ *     gb_count_geno(b, m1, m2, s, cnt)
+ *                                    count the genotypes of markers m1
+ *                                    and m2 of the individuals of
+ *                                    segment s typed at both
+ *
+ * gb_count sets cnt[0] to the number of individuals typed for
+ * both alleles, and cnt[1], cnt[2] and cnt[3] to the numbers of those
+ * with allele 1 at m1, allele 1 at m2, and allele 1 at both.
+ * gb_count_geno sets cnt[g1][g2] to the number of individuals with g1
+ * copies of allele 1 at m1 and g2 copies at m2. The counts
+ * come from AND and popcount over whole words. There are versions of
+ * the word loop for AVX-512, AVX2, the POPCNT instruction, and plain C;
+ * on x86 the fastest one supported by the processor is chosen when the
+ * first matrix is allocated, and elsewhere the plain C one is used.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define GB_X86
+#include <immintrin.h>
+#endif
+
+#include "bitgeno.h"
+#include "genomat.h"
+
+typedef void (*CountFn) (uint64_t *, uint64_t *, uint64_t *, uint64_t *,
+                         int, long *);
+
+static CountFn count_words;
+
+/*
+ *  Word loop of the scalar versions: m is the mask of individuals typed
+ *  at both alleles, x1 and x2 the allele 1 planes.
+ */
+
+#define COUNT_LOOP(popcount)						\
+    for (w = 0; w < nword; w++) {					\
+        m = t1[w] & t2[w];						\
+        n[0] += popcount(m);						\
+        n[1] += popcount(m & x1[w]);					\
+        n[2] += popcount(m & x2[w]);					\
+        n[3] += popcount(m & x1[w] & x2[w]);				\
+    }
+
+static void
+count_c (uint64_t *t1, uint64_t *x1, uint64_t *t2, uint64_t *x2,
+         int nword, long *n)
+{
+    int w;
+    uint64_t m;
+
+    COUNT_LOOP(__builtin_popcountll)
+}
+
+#ifdef GB_X86
+
+__attribute__((target("popcnt"))) static void
+count_popcnt (uint64_t *t1, uint64_t *x1, uint64_t *t2, uint64_t *x2,
+              int nword, long *n)
+{
+    int w;
+    uint64_t m;
+
+    COUNT_LOOP(__builtin_popcountll)
+}
+
+/*
+ *  The vector versions count the bits of each byte by table lookup on
+ *  its two nibbles, and sum the byte counts into 64-bit lanes. A segment
+ *  need not start on a vector boundary, so the loads are unaligned, and
+ *  the words after the last whole vector are counted by count_c.
+ */
+
+__attribute__((target("avx2"))) static inline __m256i
+popcount256 (__m256i v)
+{
+    __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                   1, 2, 2, 3, 2, 3, 3, 4,
+                                   0, 1, 1, 2, 1, 2, 2, 3,
+                                   1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i low = _mm256_set1_epi8(0x0f);
+    __m256i c;
+
+    c = _mm256_add_epi8(
+            _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low)),
+            _mm256_shuffle_epi8(lut,
+                _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+
+    return _mm256_sad_epu8(c, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2"))) static void
+count_avx2 (uint64_t *t1, uint64_t *x1, uint64_t *t2, uint64_t *x2,
+            int nword, long *n)
+{
+    int i, w;
+    __m256i m, a, b, acc[4];
+    uint64_t sum[4];
+
+    for (i = 0; i < 4; i++)
+        acc[i] = _mm256_setzero_si256();
+
+    for (w = 0; w + 4 <= nword; w += 4) {
+        m = _mm256_and_si256(_mm256_loadu_si256((__m256i *) (t1 + w)),
+                             _mm256_loadu_si256((__m256i *) (t2 + w)));
+        a = _mm256_and_si256(m, _mm256_loadu_si256((__m256i *) (x1 + w)));
+        b = _mm256_and_si256(m, _mm256_loadu_si256((__m256i *) (x2 + w)));
+        acc[0] = _mm256_add_epi64(acc[0], popcount256(m));
+        acc[1] = _mm256_add_epi64(acc[1], popcount256(a));
+        acc[2] = _mm256_add_epi64(acc[2], popcount256(b));
+        acc[3] = _mm256_add_epi64(acc[3],
+                                  popcount256(_mm256_and_si256(a, b)));
+    }
+
+    for (i = 0; i < 4; i++) {
+        _mm256_storeu_si256((__m256i *) sum, acc[i]);
+        n[i] += sum[0] + sum[1] + sum[2] + sum[3];
+    }
+    if (w < nword)
+        count_c(t1 + w, x1 + w, t2 + w, x2 + w, nword - w, n);
+}
+
+__attribute__((target("avx512f,avx512bw"))) static inline __m512i
+popcount512 (__m512i v)
+{
+    __m512i lut = _mm512_set_epi64(0x0403030203020201LL, 0x0302020102010100LL,
+                                   0x0403030203020201LL, 0x0302020102010100LL,
+                                   0x0403030203020201LL, 0x0302020102010100LL,
+                                   0x0403030203020201LL, 0x0302020102010100LL);
+    __m512i low = _mm512_set1_epi8(0x0f);
+    __m512i c;
+
+    c = _mm512_add_epi8(
+            _mm512_shuffle_epi8(lut, _mm512_and_si512(v, low)),
+            _mm512_shuffle_epi8(lut,
+                _mm512_and_si512(_mm512_srli_epi16(v, 4), low)));
+
+    return _mm512_sad_epu8(c, _mm512_setzero_si512());
+}
+
+__attribute__((target("avx512f,avx512bw"))) static void
+count_avx512 (uint64_t *t1, uint64_t *x1, uint64_t *t2, uint64_t *x2,
+              int nword, long *n)
+{
+    int i, w;
+    __m512i m, a, b, acc[4];
+
+    for (i = 0; i < 4; i++)
+        acc[i] = _mm512_setzero_si512();
+
+    for (w = 0; w + 8 <= nword; w += 8) {
+        m = _mm512_and_si512(_mm512_loadu_si512(t1 + w),
+                             _mm512_loadu_si512(t2 + w));
+        a = _mm512_and_si512(m, _mm512_loadu_si512(x1 + w));
+        b = _mm512_and_si512(m, _mm512_loadu_si512(x2 + w));
+        acc[0] = _mm512_add_epi64(acc[0], popcount512(m));
+        acc[1] = _mm512_add_epi64(acc[1], popcount512(a));
+        acc[2] = _mm512_add_epi64(acc[2], popcount512(b));
+        acc[3] = _mm512_add_epi64(acc[3],
+                                  popcount512(_mm512_and_si512(a, b)));
+    }
+
+    for (i = 0; i < 4; i++)
+        n[i] += _mm512_reduce_add_epi64(acc[i]);
+    if (w < nword)
+        count_c(t1 + w, x1 + w, t2 + w, x2 + w, nword - w, n);
+}
+
+#endif /* GB_X86 */
+
+/*
+ *  Allocate size bytes, zeroed, on a 64-byte boundary.
+ */
+
+static void *
+alloc_zero (size_t size)
+{
+    void *ptr;
+
+    if (posix_memalign(&ptr, 64, size ? size : 64)) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+    memset(ptr, 0, size);
+
+    return ptr;
+}
+
+void
+gb_alloc (struct BitGeno *b, int nmrk, int nind, int nseg, int *seg)
+{
+    int i, s, *n;
+
+    if (!count_words) {
+#ifdef GB_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512bw"))
+            count_words = count_avx512;
+        else if (__builtin_cpu_supports("avx2"))
+            count_words = count_avx2;
+        else if (__builtin_cpu_supports("popcnt"))
+            count_words = count_popcnt;
+        else
+            count_words = count_c;
+#else
+        count_words = count_c;
+#endif
+    }
+
+    b->nmrk = nmrk;
+    b->nind = nind;
+    b->nseg = nseg;
+    b->segoff = (int *) alloc_zero((nseg + 1)*sizeof(int));
+    b->bit = (int *) alloc_zero(nind*sizeof(int));
+    n = (int *) alloc_zero(nseg*sizeof(int));
+
+    for (i = 0; i < nind; i++)
+        n[seg[i]]++;
+    b->segoff[0] = 0;
+    for (s = 0; s < nseg; s++)
+        b->segoff[s+1] = b->segoff[s] + (n[s] + 63)/64;
+    b->nword = b->segoff[nseg];
+
+    for (s = 0; s < nseg; s++)
+        n[s] = 0;
+    for (i = 0; i < nind; i++)
+        b->bit[i] = 64*b->segoff[seg[i]] + n[seg[i]]++;
+    free(n);
+
+    b->bits = (uint64_t *) alloc_zero(8*GB_NPLANE*(size_t) nmrk*b->nword);
+    b->row = 0;
+}
+
+void
+gb_free (struct BitGeno *b)
+{
+    free(b->bits);
+    free(b->segoff);
+    free(b->bit);
+    b->bits = 0;
+}
+
+void
+gb_set_marker (struct BitGeno *b, int m, uint8_t *all1, uint8_t *all2)
+{
+    int i, p;
+    uint8_t *all;
+
+    for (p = 0; p < GB_NPLANE; p++)
+        memset(GB_PLANE(b, m, p), 0, 8*(size_t) b->nword);
+
+    for (i = 0; i < b->nind; i++) {
+        for (p = 0; p < 4; p += 2) {
+            all = p ? all2 : all1;
+            if (all[i] != GM_MISSING) {
+                GB_SET(GB_PLANE(b, m, p), b->bit[i]);
+                if (all[i] == 1)
+                    GB_SET(GB_PLANE(b, m, p + 1), b->bit[i]);
+            }
+        }
+        if (all1[i] != GM_MISSING && all2[i] != GM_MISSING) {
+            GB_SET(GB_PLANE(b, m, 4), b->bit[i]);
+            if ((all1[i] == 1) != (all2[i] == 1))
+                GB_SET(GB_PLANE(b, m, 5), b->bit[i]);
+            else if (all1[i] == 1)
+                GB_SET(GB_PLANE(b, m, 6), b->bit[i]);
+        }
+    }
+}
+
+void
+gb_count (struct BitGeno *b, int m1, int a1, int m2, int a2, int s, int *cnt)
+{
+    int i, w = b->segoff[s];
+    long n[4];
+
+    for (i = 0; i < 4; i++)
+        n[i] = 0;
+    count_words(GB_PLANE(b, m1, 2*a1) + w, GB_PLANE(b, m1, 2*a1 + 1) + w,
+                GB_PLANE(b, m2, 2*a2) + w, GB_PLANE(b, m2, 2*a2 + 1) + w,
+                b->segoff[s+1] - w, n);
+    for (i = 0; i < 4; i++)
+        cnt[i] = n[i];
+}
+
+/*
+ *  The heterozygous and homozygous planes, masked by the planes of both
+ *  alleles typed, give the joint counts of heterozygotes (H) and allele
+ *  1 homozygotes (B) at the two markers. The rest follow from the
+ *  margins.
+ */
+
+void
+gb_count_geno (struct BitGeno *b, int m1, int m2, int s, int cnt[3][3])
+{
+    int w = b->segoff[s], nword = b->segoff[s+1] - w;
+    uint64_t *t1, *t2;
+    long hh[4], hb[4], bh[4], bb[4];
+    int i;
+
+    for (i = 0; i < 4; i++)
+        hh[i] = hb[i] = bh[i] = bb[i] = 0;
+    t1 = GB_PLANE(b, m1, 4) + w;
+    t2 = GB_PLANE(b, m2, 4) + w;
+    count_words(t1, GB_PLANE(b, m1, 5) + w, t2, GB_PLANE(b, m2, 5) + w,
+                nword, hh);
+    count_words(t1, GB_PLANE(b, m1, 5) + w, t2, GB_PLANE(b, m2, 6) + w,
+                nword, hb);
+    count_words(t1, GB_PLANE(b, m1, 6) + w, t2, GB_PLANE(b, m2, 5) + w,
+                nword, bh);
+    count_words(t1, GB_PLANE(b, m1, 6) + w, t2, GB_PLANE(b, m2, 6) + w,
+                nword, bb);
+
+    cnt[1][1] = hh[3];
+    cnt[1][2] = hb[3];
+    cnt[2][1] = bh[3];
+    cnt[2][2] = bb[3];
+    cnt[1][0] = hh[1] - hh[3] - hb[3];
+    cnt[2][0] = bb[1] - bh[3] - bb[3];
+    cnt[0][1] = hh[2] - hh[3] - bh[3];
+    cnt[0][2] = bb[2] - hb[3] - bb[3];
+    cnt[0][0] = hh[0] - cnt[1][0] - cnt[1][1] - cnt[1][2]
+                      - cnt[2][0] - cnt[2][1] - cnt[2][2]
+                      - cnt[0][1] - cnt[0][2];
+}
@@ -0,0 +1,54 @@
+/*
+ * bitgeno.h
+ *
+ * Bit-plane genotype matrix, for markers with at most two alleles. The
+ * genotypes of all individuals at a marker are held in GB_NPLANE planes
+ * of one bit per individual:
+ *
+ *     plane 0      first allele typed
+ *     plane 1      first allele is allele 1
+ *     plane 2      second allele typed
+ *     plane 3      second allele is allele 1
+ *     plane 4      both alleles typed
+ *     plane 5      heterozygous
+ *     plane 6      homozygous for allele 1
+ *
+ * An allele which is typed but not allele 1 is allele 0.
+ *
+ * The individuals are divided into segments, e.g. the cells of a
+ * stratification of the sample, and the bits of each segment are
+ * contiguous, in the order of the individuals. Each segment begins on a
+ * 64-bit word, so a plane is nword words, with the unused bits of the
+ * last word of each segment zero. Counts are made over one segment.
+ *
+ * With a row map, as that of a spilled genotype matrix, or one of just
+ * the markers to be counted, only the markers mapped are held: the
+ * planes of marker m are in slot row[m] of nmrk.
+ *
+ */
+
+#include <stdint.h>
+
+struct BitGeno {
+    int nmrk;			/* number of markers			*/
+    int nind;			/* number of individuals		*/
+    int nword;			/* 64-bit words per plane		*/
+    int nseg;			/* number of segments			*/
+    int *segoff;		/* first word of each segment, and nword */
+    int *bit;			/* bit of each individual in a plane	*/
+    uint64_t *bits;		/* planes, marker by marker		*/
+    int *row;			/* slot of each marker, or 0 if all held */
+} ;
+
+#define GB_NPLANE		7
+#define GB_ROW(b, m)		((b)->row ? (b)->row[m] : (m))
+#define GB_PLANE(b, m, p)	\
+	((b)->bits + ((size_t) GB_NPLANE*GB_ROW(b, m) + (p))*(b)->nword)
+#define GB_SET(w, i)		((w)[(i) >> 6] |= (uint64_t) 1 << ((i) & 63))
+
+void gb_alloc (struct BitGeno *b, int nmrk, int nind, int nseg, int *seg);
+void gb_free (struct BitGeno *b);
+void gb_set_marker (struct BitGeno *b, int m, uint8_t *all1, uint8_t *all2);
+void gb_count (struct BitGeno *b, int m1, int a1, int m2, int a2, int s,
+               int *cnt);
+void gb_count_geno (struct BitGeno *b, int m1, int m2, int s, int cnt[3][3]);
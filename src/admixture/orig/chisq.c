@@ -0,0 +1,175 @@
+/*
+ * chisq.c
+ *
+ *
+ * Chi-square probabilities, as described in chisq.h.
+ *
+ *     chi_p(chi, df)              P(X >= chi), X chi-square with df
+ *                                 degrees of freedom
+ *     chi_cdf(chi, df)            P(X <= chi)
+ *     chi_p_array(n, chi, df, p)  p[i] = chi_p(chi[i], df), i < n
+ *
+ * The probabilities are the regularized incomplete gamma functions
+ * P(df/2, chi/2) and Q(df/2, chi/2), by series for small chi and by
+ * continued fraction for large, so the upper tail keeps its precision
+ * however small it is. With one degree of freedom, the common case,
+ * Q(1/2, x) = erfc(sqrt(x)) is used instead. A chi of 0 or less has
+ * P = 0 and Q = 1; a NaN chi or a df of 0 or less gives NaN.
+ *
+ */
+
+#include <math.h>
+
+#include "chisq.h"
+
+#define MAXIT	1000	/* max # terms of series or fraction	*/
+#define EPS	1e-15	/* relative accuracy			*/
+#define TINY	1e-300	/* guard against division by zero	*/
+
+/*
+ *  log Gamma(a), a > 0, by the Lanczos approximation (g = 7, n = 9),
+ *  with reflection for a < 1/2. lgamma() is not used as it may set the
+ *  global signgam.
+ */
+
+static double
+log_gamma (double a)
+{
+    static double c[9] = {
+        0.99999999999980993, 676.5203681218851, -1259.1392167224028,
+        771.32342877765313, -176.61502916214059, 12.507343278686905,
+        -0.13857109526572012, 9.9843695780195716e-6, 1.5056327351493116e-7
+    };
+    double x, t, sum;
+    int i;
+
+    if (a < 0.5)
+        return log(M_PI/sin(M_PI*a)) - log_gamma(1 - a);
+
+    x = a - 1;
+    sum = c[0];
+    for (i = 1; i < 9; i++)
+        sum += c[i]/(x + i);
+    t = x + 7.5;
+
+    return 0.5*log(2*M_PI) + (x + 0.5)*log(t) - t + log(sum);
+}
+
+/*
+ *  P(a, x) by its series, for x < a + 1.
+ */
+
+static double
+gamma_series (double a, double x)
+{
+    double ap, del, sum;
+    int i;
+
+    ap = a;
+    del = sum = 1/a;
+    for (i = 0; i < MAXIT; i++) {
+        ap += 1;
+        del *= x/ap;
+        sum += del;
+        if (fabs(del) < fabs(sum)*EPS)
+            break;
+    }
+
+    return sum*exp(-x + a*log(x) - log_gamma(a));
+}
+
+/*
+ *  Q(a, x) by its continued fraction (modified Lentz), for x >= a + 1.
+ */
+
+static double
+gamma_fraction (double a, double x)
+{
+    double an, b, c, d, h, del;
+    int i;
+
+    b = x + 1 - a;
+    c = 1/TINY;
+    d = 1/b;
+    h = d;
+    for (i = 1; i <= MAXIT; i++) {
+        an = -i*(i - a);
+        b += 2;
+        d = an*d + b;
+        if (fabs(d) < TINY)
+            d = TINY;
+        c = b + an/c;
+        if (fabs(c) < TINY)
+            c = TINY;
+        d = 1/d;
+        del = d*c;
+        h *= del;
+        if (fabs(del - 1) < EPS)
+            break;
+    }
+
+    return exp(-x + a*log(x) - log_gamma(a))*h;
+}
+
+double
+chi_p (double chi, double df)
+{
+    double a = df/2, x = chi/2;
+
+    if (isnan(chi) || !(df > 0))
+        return NAN;
+    if (chi <= 0)
+        return 1;
+    if (df == 1)
+        return erfc(sqrt(x));
+    if (df == 2)
+        return exp(-x);
+    if (x < a + 1)
+        return 1 - gamma_series(a, x);
+
+    return gamma_fraction(a, x);
+}
+
+double
+chi_cdf (double chi, double df)
+{
+    double a = df/2, x = chi/2;
+
+    if (isnan(chi) || !(df > 0))
+        return NAN;
+    if (chi <= 0)
+        return 0;
+    if (df == 1)
+        return erf(sqrt(x));
+    if (df == 2)
+        return -expm1(-x);
+    if (x < a + 1)
+        return gamma_series(a, x);
+
+    return 1 - gamma_fraction(a, x);
+}
+
+/*
+ *  The p-values of an array of statistics. The loop for one degree of
+ *  freedom has no calls but erfc() and sqrt(), and no branches but
+ *  selects, so that the compiler may vectorize it.
+ */
+
+void
+chi_p_array (int n, double *chi, double df, double *p)
+{
+    int i;
+
+    if (df == 1) {
+        for (i = 0; i < n; i++)
+            p[i] = erfc(sqrt(chi[i] > 0 ? chi[i]/2 : 0));
+        for (i = 0; i < n; i++) {
+            if (isnan(chi[i]))
+                p[i] = chi[i];
+        }
+        return;
+    }
+
+    for (i = 0; i < n; i++)
+        p[i] = chi_p(chi[i], df);
+}
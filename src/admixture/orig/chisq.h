@@ -0,0 +1,13 @@
+/*
+ * chisq.h
+ *
+ * Chi-square distribution: upper tail probabilities (p-values) and the
+ * distribution function, from the regularized incomplete gamma
+ * function in double precision. The routines keep no state, so they
+ * may be called from any number of threads at once.
+ *
+ */
+
+double chi_p (double chi, double df);
+double chi_cdf (double chi, double df);
+void chi_p_array (int n, double *chi, double df, double *p);
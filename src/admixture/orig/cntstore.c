@@ -0,0 +1,200 @@
+/*
+ * cntstore.c
+ *
+ *
+ * Read access to the binary count store written by program count. The
+ * layout of the store is described in cntstore.h.
+ *
+ *     cs_is_store(file)            non-zero if file is a count store
+ *     cs_open(file, cs)            map a count store into memory
+ *     cs_find(cs, name)            marker number, or -1 if not found
+ *     cs_counts(cs, m, aff, pop)   counts for one stratum of marker m
+ *     cs_freqs(cnt, n, frq)        frequencies, rounded as by count
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "cntstore.h"
+
+int
+cs_is_store (char *file)
+{
+    char magic[8];
+    FILE *fp;
+    int n;
+
+    fp = fopen(file, "r");
+    if (!fp)
+        return 0;
+    n = fread(magic, 1, sizeof(magic), fp);
+    fclose(fp);
+
+    return n == sizeof(magic) && !memcmp(magic, CS_MAGIC, sizeof(magic));
+}
+
+void
+cs_open (char *file, struct CntStore *cs)
+{
+    int fd, i;
+    struct stat st;
+    struct CsHeader *hdr;
+
+    fd = open(file, O_RDONLY);
+    if (fd == -1) {
+        fprintf(stderr, "cannot open %s\n", file);
+        exit(1);
+    }
+    if (fstat(fd, &st) || st.st_size < (off_t) sizeof(struct CsHeader)) {
+        fprintf(stderr, "%s: not a count store\n", file);
+        exit(1);
+    }
+
+    cs->size = st.st_size;
+    cs->base = (char *) mmap(0, cs->size, PROT_READ, MAP_SHARED, fd, 0);
+    if (cs->base == (char *) MAP_FAILED) {
+        fprintf(stderr, "cannot map %s\n", file);
+        exit(1);
+    }
+    close(fd);
+
+    hdr = (struct CsHeader *) cs->base;
+    if (memcmp(hdr->magic, CS_MAGIC, sizeof(hdr->magic)) || hdr->nmrk < 0
+            || hdr->npop < 0 || hdr->stroff > (int64_t) cs->size
+            || hdr->popoff + 8*(int64_t) hdr->npop > (int64_t) cs->size
+            || hdr->mrkoff + (int64_t) sizeof(struct CsMarker)*hdr->nmrk
+                   > (int64_t) cs->size
+            || hdr->ndxoff + 4*(int64_t) hdr->nmrk > (int64_t) cs->size) {
+        fprintf(stderr, "%s: not a count store\n", file);
+        exit(1);
+    }
+
+    cs->nmrk = hdr->nmrk;
+    cs->npop = hdr->npop;
+    cs->pops = (int64_t *) (cs->base + hdr->popoff);
+    cs->mrk = (struct CsMarker *) (cs->base + hdr->mrkoff);
+    cs->ndx = (int32_t *) (cs->base + hdr->ndxoff);
+    cs->str = cs->base + hdr->stroff;
+
+    for (i = 0; i < cs->nmrk; i++) {
+        if (cs->mrk[i].nall < 0 || cs->mrk[i].block
+                + CS_BLOCKSIZE(cs->mrk[i].nall, cs->npop) > hdr->stroff) {
+            fprintf(stderr, "%s: count store is damaged\n", file);
+            exit(1);
+        }
+    }
+}
+
+/*
+ *  Binary search of the name index.
+ */
+
+int
+cs_find (struct CntStore *cs, char *name)
+{
+    int lo, hi, mid, c;
+
+    lo = 0;
+    hi = cs->nmrk - 1;
+    while (lo <= hi) {
+        mid = (lo + hi)/2;
+        c = strcmp(name, cs_marker(cs, cs->ndx[mid]));
+        if (!c)
+            return cs->ndx[mid];
+        if (c < 0)
+            hi = mid - 1;
+        else
+            lo = mid + 1;
+    }
+
+    return -1;
+}
+
+char *
+cs_marker (struct CntStore *cs, int m)
+{
+    return cs->str + cs->mrk[m].name;
+}
+
+int
+cs_nall (struct CntStore *cs, int m)
+{
+    return cs->mrk[m].nall;
+}
+
+char *
+cs_allele (struct CntStore *cs, int m, int a)
+{
+    return cs->str + ((int64_t *) (cs->base + cs->mrk[m].block))[a];
+}
+
+char *
+cs_pop (struct CntStore *cs, int p)
+{
+    return cs->str + cs->pops[p];
+}
+
+/*
+ *  Returns the allele counts, followed by the genotype counts, of marker
+ *  m for the given affection status (0 = all) and population (-1 = all).
+ */
+
+int32_t *
+cs_counts (struct CntStore *cs, int m, int aff, int pop)
+{
+    int nall = cs->mrk[m].nall;
+
+    return (int32_t *) (cs->base + cs->mrk[m].block + 8*(int64_t) nall)
+               + CS_STRATUM(cs->npop, aff, pop)*(int64_t) CS_NCNT(nall);
+}
+
+/*
+ *  Convert n counts to frequencies exactly as program count writes them:
+ *  each frequency is rounded to 5 decimal places, except the last
+ *  non-zero one, which is set so that the frequencies sum to 1. Returns
+ *  the number of non-zero counts.
+ */
+
+int
+cs_freqs (int32_t *cnt, int n, double *frq)
+{
+    int i, nfrq, nz;
+    double sum, num, asum;
+    char buf[32];
+
+    nfrq = 0;
+    sum = 0;
+    for (i = 0; i < n; i++) {
+        if (cnt[i]) {
+            nfrq++;
+            sum += cnt[i];
+        }
+    }
+
+    nz = nfrq;
+    asum = 0;
+    for (i = 0; i < n; i++) {
+        frq[i] = 0;
+        if (cnt[i]) {
+            nfrq--;
+            if (nfrq) {
+                sprintf(buf, "%7.5f", cnt[i]/sum);
+                sscanf(buf, "%lf", &num);
+                asum += num;
+                frq[i] = num;
+            }
+            else {
+                sprintf(buf, "%7.5f", 1. - asum);
+                sscanf(buf, "%lf", &frq[i]);
+            }
+        }
+    }
+
+    return nz;
+}
@@ -0,0 +1,77 @@
+/*
+ * cntstore.h
+ *
+ * Binary store of the allele and genotype counts tallied by program
+ * count. The file is read by mapping it into memory, so that the
+ * counts for one marker can be reached without reading the rest of
+ * the file.
+ *
+ * All offsets are in bytes from the start of the file, except string
+ * offsets, which are from the start of the string table. The file is
+ * laid out as follows:
+ *
+ *     header           struct CsHeader
+ *     population IDs   int64 string offset, for each population
+ *     marker index     struct CsMarker, for each marker, in file order
+ *     name index       int32 marker numbers, sorted by marker name
+ *     marker blocks    one per marker (see below)
+ *     string table     NUL-terminated strings
+ *
+ * A marker block holds the string offsets of the marker's alleles, in
+ * sorted order, followed by the counts for each stratum. A stratum is
+ * one combination of affection status (0 = all, 1 = unaffected, 2 =
+ * affected) and population (-1 = all); its counts are the nall allele
+ * counts followed by the nall*(nall+1)/2 genotype counts, with the
+ * genotype a/b, a >= b, at position a*(a+1)/2 + b. Every section begins
+ * on an 8-byte boundary.
+ *
+ */
+
+#include <stdint.h>
+
+#define CS_MAGIC	"CNTSTOR1"
+
+struct CsHeader {
+    char magic[8];		/* CS_MAGIC				*/
+    int32_t nmrk;		/* number of markers			*/
+    int32_t npop;		/* number of populations		*/
+    int64_t popoff;		/* offset of population IDs		*/
+    int64_t mrkoff;		/* offset of marker index		*/
+    int64_t ndxoff;		/* offset of name index			*/
+    int64_t stroff;		/* offset of string table		*/
+} ;
+
+struct CsMarker {
+    int64_t name;		/* string offset of marker name		*/
+    int64_t block;		/* offset of marker block		*/
+    int32_t nall;		/* number of alleles			*/
+    int32_t pad;
+} ;
+
+struct CntStore {
+    char *base;			/* mapped file				*/
+    size_t size;		/* file size				*/
+    int nmrk;			/* number of markers			*/
+    int npop;			/* number of populations		*/
+    int64_t *pops;		/* population ID string offsets		*/
+    struct CsMarker *mrk;	/* marker index				*/
+    int32_t *ndx;		/* name index				*/
+    char *str;			/* string table				*/
+} ;
+
+#define CS_ALIGN(n)		(((n) + 7) & ~(int64_t) 7)
+#define CS_NSTRATA(npop)	(3*((npop) + 1))
+#define CS_STRATUM(npop, aff, pop)	((aff)*((npop) + 1) + (pop) + 1)
+#define CS_NCNT(nall)		((nall) + (nall)*((nall) + 1)/2)
+#define CS_BLOCKSIZE(nall, npop) \
+	CS_ALIGN(8*(int64_t) (nall) + 4*(int64_t) CS_NSTRATA(npop)*CS_NCNT(nall))
+
+int cs_is_store (char *file);
+void cs_open (char *file, struct CntStore *cs);
+int cs_find (struct CntStore *cs, char *name);
+char *cs_marker (struct CntStore *cs, int m);
+int cs_nall (struct CntStore *cs, int m);
+char *cs_allele (struct CntStore *cs, int m, int a);
+char *cs_pop (struct CntStore *cs, int p);
+int32_t *cs_counts (struct CntStore *cs, int m, int aff, int pop);
+int cs_freqs (int32_t *cnt, int n, double *frq);
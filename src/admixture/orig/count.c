@@ -8,14 +8,19 @@
  * This program reads the genotype data for a set of individuals and
  * generates a tally of the marker alleles and genotypes. Allele and
  * genotype counts are broken down both by population and affection
- * status. The counts are stored in files, one for allele counts and
- * one for genotype counts, which are used by various other programs.
- * There is a limit of 2 populations (MXPOP) and 40 alleles per marker
- * (MXALL). If necessary, these limits can be increased in the source
- * code and the program recompiled.
+ * status, or by any other set of stratification axes. The counts are
+ * stored in files, one for allele counts and one for genotype counts,
+ * which are used by various other programs.
+ * The count tables for each marker are sized by the number of alleles
+ * actually observed, so there is no fixed limit on the number of
+ * populations or alleles per marker.
  *
  *
- * Usage:  count [-M missval] locfile pedfile afrqout gfrqout
+ * Usage:  count [-M missval] [-t nthreads] [-x strata] [-C covfile]
+ *               [-Q prefix] [-b store] locfile pedfile afrqout gfrqout
+ *         count [-M missval] [-t nthreads] [-x strata] [-C covfile]
+ *               [-Q prefix] -w shard locfile pedfile
+ *         count [-b store] -r afrqout gfrqout shard ...
  *
  *         locfile      locus file (marker info)
  *         pedfile      pedigree file (marker genotypes)
@@ -24,10 +29,70 @@
  *
  *         options:
  *           -M missval   missing allele value in quotes, e.g. "0"
+ *           -t nthreads  number of threads used to read the pedigree file
+ *           -x strata    stratification axes, e.g. "aff,pop,sex"
+ *           -C covfile   covariates file, for the cov axis
+ *           -Q prefix    write QC tables prefix.mqc and prefix.iqc
+ *           -w shard     write the raw counts to a shard file
+ *           -r           merge shard files into allele/genotype counts
+ *           -b store     also write the counts to a binary count store
  *
  *   The missing allele value is used in genotypes to denote an untyped
  *   allele. The default missing value is an asterisk (*).
  *
+ *   With the -t option, the pedigree file is split into nthreads
+ *   pieces at line boundaries, and each piece is tallied by a separate
+ *   thread. The output is the same for any number of threads. Each
+ *   thread keeps its own count tables, so memory grows with nthreads by
+ *   the size of the allele and genotype counts; the allele names are
+ *   stored once, shared by all threads.
+ *
+ *   With the -w option, no frequency files are written; instead, the
+ *   raw allele and genotype counts for the individuals in the pedigree
+ *   file are written to a shard file. The -r option sums the counts in
+ *   any number of shard files, which must all have been made with the
+ *   same locus file, and writes the usual allele and genotype frequency
+ *   files. A dataset that arrives in batches can thus be counted one
+ *   batch at a time. Merging the shards for the pieces of a pedigree
+ *   file, in file order, gives exactly the output of counting the whole
+ *   file.
+ *
+ *   The -b option writes the same counts to a binary count store as well
+ *   as to the frequency files. The store holds an index of the markers,
+ *   sorted by name, a table of allele names, and, for each marker, a
+ *   block of integer allele and genotype counts for every combination of
+ *   affection status and population. Programs hetfst, hwtest and ldtest
+ *   accept a count store in place of the frequency files; the layout is
+ *   described in cntstore.h.
+ *
+ *   With the -x option, the counts are broken down by the given
+ *   stratification axes instead of by affection status and population.
+ *   The axes are a comma-separated list chosen from: aff (affection
+ *   status), pop (population ID), sex, site:n (the first n characters of
+ *   the family ID), and cov (the level given for the individual in the
+ *   covariates file named with the -C option). The default is aff,pop.
+ *   However many axes are given, the pedigree file is read only once;
+ *   counts are kept for each combination of levels that occurs, and are
+ *   summed into the combined strata when the output is written. A shard
+ *   file records the axes it was made with, so -x and -C are given when
+ *   the shards are written, not with -r. The -b option requires the
+ *   default axes.
+ *
+ *   With the -Q option, quality control tables are also written, from
+ *   the same reading of the pedigree file. The file prefix.mqc has one
+ *   line for each marker and stratum, with the strata as in the frequency
+ *   files; each line gives the marker name and stratum, the number of
+ *   individuals, the numbers with both alleles typed, with one allele
+ *   missing and with both alleles missing, the fraction not fully typed,
+ *   the number of heterozygotes, and the observed heterozygosity, i.e.
+ *   the fraction of fully typed individuals who are heterozygous ("-" if
+ *   there are none). The file prefix.iqc has one line for each individual,
+ *   in pedigree file order, giving the family and individual IDs, the
+ *   numbers of markers with both alleles typed, with one allele missing
+ *   and with both missing, the fraction of markers not fully typed, the
+ *   number of heterozygous markers, and the observed heterozygosity. The
+ *   -Q option cannot be used with -r.
+ *
  *
  * File formats:
  *
@@ -57,6 +122,11 @@
  *     Pedigree file:
  *       Blow Joe 1 Caucasian M A a 123 131
  *
+ *   The covariates file, used with the cov axis, is blank- or tab-delimited
+ *   and has one line per individual, giving the family ID, the individual
+ *   ID, and the individual's covariate level. Every individual in the
+ *   pedigree file must be listed.
+ *
  *
  *   There are two blank-delimited output files - one for allele counts,
  *   the other for genotype counts. The first three fields on each line
@@ -75,26 +145,83 @@
  *
  *       D19S571 a - 290 312 17 0.18478
  *
+ *   With the -x option, the affection status and population ID fields are
+ *   replaced by one field for each axis, in the order given, and a hyphen
+ *   in a field means that the count and frequency are for all levels of
+ *   that axis combined. The strata are written in the same order as for
+ *   the default axes, with the stratum for all individuals last.
+ *
  *
  */
 
+#define _FILE_OFFSET_BITS 64
+
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-
-#define MXPOP	4	/* max # populations		*/
-#define MXALL	40	/* max # alleles per marker	*/
+#include <stdarg.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include "thrpool.h"
+#include "cntstore.h"
 
 #define MISSVAL	"*"	/* missing value		*/
 
 #define ALLBLK	256	/* # array elements malloc'd at a time		*/
 
+#define HASHALL	16	/* # alleles above which genotype counts are hashed */
+
+
+#define MXAXIS	8	/* max # stratification axes	*/
+
+#define STRATA	"aff,pop"	/* default stratification	*/
+
+/*
+ *  Individuals are cross-classified by a set of stratification axes.
+ *  Counts are kept for each cell of the cross-classification, i.e. for
+ *  each combination of axis levels which occurs in the data, and the
+ *  counts written to the output files, for every stratum and every
+ *  marginal, are sums over cells.
+ */
+
+#define AX_AFF	0	/* affection status		*/
+#define AX_POP	1	/* population			*/
+#define AX_SEX	2	/* sex				*/
+#define AX_SITE	3	/* family ID prefix		*/
+#define AX_COV	4	/* level from covariates file	*/
 
-struct Pop {
-    int acntu[MXALL];		/* allele counts for unaffecteds	*/
-    int acnta[MXALL];		/* allele counts for affecteds		*/
-    int gcntu[MXALL][MXALL];	/* genotype counts for unaffecteds	*/
-    int gcnta[MXALL][MXALL];	/* genotype counts for affecteds	*/
+struct Axis {
+    int type;			/* AX_AFF, AX_POP, ...			*/
+    int len;			/* # characters of family ID (AX_SITE)	*/
+} ;
+
+int naxis;			/* number of stratification axes	*/
+struct Axis axis[MXAXIS];	/* stratification axes			*/
+char *axspec = STRATA;		/* axes as given by the -x option	*/
+
+struct Strata {
+    int nlev[MXAXIS];		/* number of levels of each axis	*/
+    char **lev[MXAXIS];		/* level names of each axis		*/
+    int ncell;			/* number of cells			*/
+    int *cellv;			/* levels of each cell, naxis per cell	*/
+    int hsize;			/* # slots in cell hash (a power of 2)	*/
+    int *hash;			/* cell numbers, -1 = empty		*/
+} ;
+
+/*
+ *  The genotype a/b, a >= b, is stored at position a*(a+1)/2 + b of a
+ *  lower-triangular table, so the table for n alleles is a prefix of
+ *  the table for n+1 alleles.
+ */
+
+#define TRI(a, b)	((a) >= (b) ? (a)*((a)+1)/2 + (b) : (b)*((b)+1)/2 + (a))
+
+struct GHash {
+    int size;			/* # slots (a power of 2)		*/
+    int nused;			/* # slots in use			*/
+    long *key;			/* cell and genotype, -1 = empty	*/
+    int *cnt;			/* genotype counts			*/
 } ;
 
 struct Marker {
@@ -102,58 +229,172 @@ struct Marker {
     int nall;			/* number of alleles			*/
     char **alleles;		/* allele names				*/
     int *all_sort;		/* sorted order of allele names		*/
-    struct Pop pop[MXPOP];	/* by-population allele/genotype counts	*/
+    int nslot;			/* # alleles with allocated counts	*/
+    int ncell;			/* # cells with allocated counts	*/
+    int *cnt;			/* by-cell allele/genotype counts	*/
+    struct GHash *ghash;	/* genotype counts, if > HASHALL alleles */
+    int nqc;			/* # cells with allocated QC counts	*/
+    int *qc;			/* by-cell QC counts, NQC per cell	*/
 } ;
 
+/*
+ *  Quality control counts, kept for each marker and cell when the -Q
+ *  option is given.
+ */
+
+#define Q_TYPED	0	/* # individuals with both alleles typed	*/
+#define Q_HALF	1	/* # individuals with one allele missing	*/
+#define Q_MISS	2	/* # individuals with both alleles missing	*/
+#define Q_HET	3	/* # heterozygous individuals			*/
+#define NQC	4
+
 int nmrk;		/* number of markers		*/
 struct Marker *mrk;
 
 
+struct Strata strata;	/* axis levels and cells	*/
+
+int ncov = 0;		/* number of covariate records	*/
+char **covkey;		/* family and individual IDs	*/
+char **covlev;		/* covariate levels		*/
+int covhsize;		/* # slots in covariate hash	*/
+int *covhash;		/* covariate record numbers	*/
+
+int nthread = 1;	/* number of threads		*/
+
 /*
- *  Only one copy of each identifier is stored, i.e. each entry
- *  in the following arrays is unique.
+ *  While the pedigree file is read, the allele names of each marker are
+ *  stored once, in a list shared by all chunks, and the allele list of
+ *  a chunk points to the shared names. Names are added under dict_lock.
  */
 
-int npop = 0;		/* number of populations	*/
-char **pops;		/* population identifiers	*/
+struct Dict {
+    int nall;			/* number of alleles			*/
+    char **alleles;		/* allele names				*/
+} ;
+
+struct Dict *dict;		/* shared allele names of each marker	*/
+pthread_mutex_t dict_lock = PTHREAD_MUTEX_INITIALIZER;
+
+char *qcout = 0;	/* QC output file prefix	*/
+
+
+/*
+ *  A byte range of the pedigree file, which is read and tallied
+ *  independently of the others.
+ */
 
-int nfamid = 0;		/* number of family IDs		*/
-char **famids;		/* family IDs			*/
+struct Chunk {
+    off_t start, end;		/* byte range, starts at a line start,
+				   end -1 = to end of file		*/
+    int nline;			/* # lines read				*/
+    struct Marker *mrk;		/* marker allele/genotype counts	*/
+    struct Strata st;		/* axis levels and cells		*/
+    char *iqc;			/* per-individual QC lines		*/
+    size_t iqcsz, iqclen;	/* size and length of iqc		*/
+    int shared;			/* allele names are in dict, not the
+				   chunk's own				*/
+    int errline;		/* line (in range) of error, 0 = none,
+				   -1 = error not on a line		*/
+    char errmsg[2][512];	/* error text before/after line number	*/
+} ;
 
-int nid = 0;		/* number of individual IDs	*/
-char **ids;		/* individual IDs		*/
+struct PedRead {
+    char *pedfile;		/* pedigree file name			*/
+    char *missval;		/* missing allele value			*/
+    struct Chunk *chunk;	/* one chunk per thread			*/
+} ;
 
 
 void show_usage (char *);
+void parse_axes (char *);
+void init_strata (struct Strata *);
+void free_strata (struct Strata *);
+int find_cell (struct Strata *, int *);
+int find_level (struct Strata *, int, char *);
+void read_cov_file (char *);
+char *find_cov (char *, char *);
+unsigned int hash_name (char *);
 void read_locus_file (char *);
 void read_pedigree_file (char *, char *);
-void do_allele_freqs (struct Marker *, int, int, FILE *);
-void do_genotype_freqs (struct Marker *, int, int, FILE *);
+void count_chunk (int, void *);
+int tally_record (struct Chunk *, char *, char *, char *, int **);
+int chunk_error (struct Chunk *, char *, char *, ...);
+void merge_chunk (struct Chunk *);
+void merge_counts (struct Marker *, struct Marker *, int *, int *);
+void write_shard (char *);
+void read_shard (char *, struct Chunk *);
+void write_store (char *);
+int64_t store_string (char *, char **, int64_t *, int64_t *);
+int cmp_mrkname (const void *, const void *);
+void free_counts (struct Marker *);
+int read_record (FILE *, char **, int *);
+int list_strata (char ***, int ***, int **);
+void write_freqs (FILE *, FILE *);
+void write_mqc (char *);
+FILE *open_qc (char *);
+void do_allele_freqs (struct Marker *, char *, int *, int, FILE *);
+void do_genotype_freqs (struct Marker *, char *, int *, int, FILE *);
+void grow_counts (struct Marker *, int, int);
+void grow_qc (struct Marker *, int);
+void count_allele (struct Marker *, int, int, int);
+void count_genotype (struct Marker *, int, int, int, int);
+int acount (struct Marker *, int, int);
+int gcount (struct Marker *, int, int, int);
+int *ghash_slot (struct GHash *, long, int);
 int get_ndx (char *, char **, int);
 int add_name (char *, char ***, int *);
+int add_allele (char *, char ***, int *);
+char *intern_allele (int, char *);
 void sort_names(char **, int, int *);
 void *allocMem (size_t);
+void *growMem (void *, size_t);
 
 
 main (int argc, char **argv)
 {
-    int i, j;
-    char *recp, rec[10000];
-    char buf[10];
+    int i;
     FILE *fpa, *fpg;
+    struct Chunk ck;
 
-    int errflg = 0;
+    int errflg = 0, merge = 0;
+    char *shard = 0, *store = 0, *covfile = 0, *spec = 0;
     char missval[10] = "";
     extern char *optarg;
     extern int optind, optopt;
 
     /* gather command line arguments */
-    while ((i = getopt(argc, argv, ":M:")) != -1) {
+    while ((i = getopt(argc, argv, ":M:t:w:rb:x:C:Q:")) != -1) {
         switch (i) {
+        case 'w':
+            shard = optarg;
+            break;
+        case 'r':
+            merge = 1;
+            break;
+        case 'b':
+            store = optarg;
+            break;
+        case 'x':
+            spec = optarg;
+            break;
+        case 'C':
+            covfile = optarg;
+            break;
+        case 'Q':
+            qcout = optarg;
+            break;
         case 'M':
             strncpy(missval, optarg, sizeof(missval)-1);
             missval[sizeof(missval)-1] = 0;
             break;
+        case 't':
+            nthread = atoi(optarg);
+            if (nthread < 1) {
+                fprintf(stderr, "-t: number of threads must be positive\n");
+                exit(1);
+            }
+            break;
         case ':':
             fprintf(stderr, "option -%c requires an operand\n", optopt);
             errflg++;
@@ -164,7 +405,24 @@ main (int argc, char **argv)
         }
     }
 
-    if (argc - optind != 4 || errflg) {
+    if (merge && shard) {
+        fprintf(stderr, "-r and -w cannot both be given\n");
+        errflg++;
+    }
+    if (store && shard) {
+        fprintf(stderr, "-b and -w cannot both be given\n");
+        errflg++;
+    }
+    if (merge && (spec || covfile)) {
+        fprintf(stderr, "-x and -C cannot be used with -r\n");
+        errflg++;
+    }
+    if (merge && qcout) {
+        fprintf(stderr, "-Q cannot be used with -r\n");
+        errflg++;
+    }
+    if (errflg || (merge && argc - optind < 3) || (shard && argc - optind != 2)
+               || (!merge && !shard && argc - optind != 4)) {
         show_usage(argv[0]);
         exit(1);
     }
@@ -174,9 +432,51 @@ main (int argc, char **argv)
         missval[sizeof(missval)-1] = 0;
     }
 
-    read_locus_file(argv[optind]);
+    if (!merge) {
+        if (spec)
+            axspec = spec;
+        parse_axes(axspec);
+        for (i = 0; i < naxis; i++) {
+            if (axis[i].type == AX_COV && !covfile) {
+                fprintf(stderr, "-x cov requires a covariates file (-C)\n");
+                exit(1);
+            }
+        }
+        if (covfile)
+            read_cov_file(covfile);
+        init_strata(&strata);
+    }
+
+    if (merge) {
+        nmrk = -1;
+        for (i = optind + 2; i < argc; i++) {
+            read_shard(argv[i], &ck);
+            merge_chunk(&ck);
+        }
+        optind -= 2;
+    }
+    else {
+        read_locus_file(argv[optind]);
+        read_pedigree_file(argv[optind+1], missval);
+        if (qcout)
+            write_mqc(qcout);
+    }
+
+    if (shard) {
+        write_shard(shard);
+        exit(0);
+    }
+
+    if (store && (naxis != 2 || axis[0].type != AX_AFF
+                             || axis[1].type != AX_POP)) {
+        fprintf(stderr, "-b requires the default strata, %s\n", STRATA);
+        exit(1);
+    }
 
-    read_pedigree_file(argv[optind+1], missval);
+    for (i = 0; i < nmrk; i++) {
+        mrk[i].all_sort = (int *) allocMem(mrk[i].nall*sizeof(int));
+        sort_names(mrk[i].alleles, mrk[i].nall, mrk[i].all_sort);
+    }
 
     fpa = fopen(argv[optind+2], "w");
     if (!fpa) {
@@ -190,86 +490,276 @@ main (int argc, char **argv)
         exit(1);
     }
 
+    write_freqs(fpa, fpg);
+
+    if (store)
+        write_store(store);
+}
+
+void
+show_usage (char *prog)
+{
+    printf("usage: %s [-M missval] [-t nthreads] [-x strata] [-C covfile]\n",
+           prog);
+    printf("           [-Q prefix] [-b store] locfile pedfile afrqout gfrqout\n");
+    printf("       %s [-M missval] [-t nthreads] [-x strata] [-C covfile]\n",
+           prog);
+    printf("           [-Q prefix] -w shard locfile pedfile\n");
+    printf("       %s [-b store] -r afrqout gfrqout shard ...\n\n", prog);
+    printf("   locfile      locus file\n");
+    printf("   pedfile      pedigree file\n");
+    printf("   afrqout      allele frequencies output file\n");
+    printf("   gfrqout      genotype frequencies output file\n");
+    printf("\n   options:\n");
+    printf("     -M missval   missing allele value in quotes\n");
+    printf("     -t nthreads  number of threads\n");
+    printf("     -x strata    stratification axes (default aff,pop)\n");
+    printf("     -C covfile   covariates file, for the cov axis\n");
+    printf("     -Q prefix    write QC tables prefix.mqc and prefix.iqc\n");
+    printf("     -w shard     write raw counts to shard file\n");
+    printf("     -r           merge shard files\n");
+    printf("     -b store     also write binary count store\n");
+    exit(1);
+}
 
 /*
- *  For each locus, sum up allele counts, then divide to get frequencies.
- *  Force the frequencies into a fixed-width format, sum the first N - 1
- *  formatted frequencies where N = #alleles, and subtract this sum from
- *  1 to get the frequency of the Nth allele. This makes the frequencies
- *  sum to 1.
+ *  Parse a stratification spec, a comma-separated list of axes:
+ *
+ *      aff       affection status
+ *      pop       population
+ *      sex       sex
+ *      site:n    the first n characters of the family ID
+ *      cov       the level given in the covariates file
  */
 
-    for (i = 0; i < nmrk; i++) {
+void parse_axes (char *spec)
+{
+    char *buf, *p, *save;
 
-        /* unaffected */
-	do_allele_freqs(&mrk[i], 1, -1, fpa);
+    buf = (char *) allocMem(strlen(spec)+1);
+    strcpy(buf, spec);
 
-        /* unaffected, by population */
-        for (j = 0; j < npop; j++) {
-	    do_allele_freqs(&mrk[i], 1, j, fpa);
+    naxis = 0;
+    for (p = strtok_r(buf, ",", &save); p; p = strtok_r(NULL, ",", &save)) {
+        if (naxis == MXAXIS) {
+            fprintf(stderr, "too many stratification axes, MXAXIS = %d\n",
+                    MXAXIS);
+            exit(1);
+        }
+        axis[naxis].len = 0;
+        if (!strcmp(p, "aff"))
+            axis[naxis].type = AX_AFF;
+        else if (!strcmp(p, "pop"))
+            axis[naxis].type = AX_POP;
+        else if (!strcmp(p, "sex"))
+            axis[naxis].type = AX_SEX;
+        else if (!strcmp(p, "cov"))
+            axis[naxis].type = AX_COV;
+        else if (!strncmp(p, "site:", 5) &&
+                 (axis[naxis].len = atoi(p + 5)) > 0)
+            axis[naxis].type = AX_SITE;
+        else {
+            fprintf(stderr, "invalid stratification axis [%s]\n", p);
+            exit(1);
         }
+        naxis++;
+    }
+
+    if (!naxis) {
+        fprintf(stderr, "no stratification axes given\n");
+        exit(1);
+    }
 
-        /* affected */
-	do_allele_freqs(&mrk[i], 2, -1, fpa);
+    free(buf);
+}
 
-        /* affected, by population */
-        for (j = 0; j < npop; j++) {
-	    do_allele_freqs(&mrk[i], 2, j, fpa);
-        }
+/*
+ *  The levels of the affection status and sex axes are fixed, so that
+ *  they are always numbered, and written, in the same order. The levels
+ *  of the other axes are numbered in the order that they are found.
+ */
 
-        /* by population */
-        for (j = 0; j < npop; j++) {
-	    do_allele_freqs(&mrk[i], 0, j, fpa);
-        }
+void init_strata (struct Strata *st)
+{
+    int i;
 
-        /* everybody */
-	do_allele_freqs(&mrk[i], 0, -1, fpa);
+    for (i = 0; i < naxis; i++) {
+        st->nlev[i] = 0;
+        if (axis[i].type == AX_AFF) {
+            add_name("U", &st->lev[i], &st->nlev[i]);
+            add_name("A", &st->lev[i], &st->nlev[i]);
+        }
+        else if (axis[i].type == AX_SEX) {
+            add_name("M", &st->lev[i], &st->nlev[i]);
+            add_name("F", &st->lev[i], &st->nlev[i]);
+        }
     }
 
+    st->ncell = 0;
+    st->cellv = 0;
+    st->hsize = 0;
+    st->hash = 0;
+}
+
+void free_strata (struct Strata *st)
+{
+    int i, j;
+
+    for (i = 0; i < naxis; i++) {
+        for (j = 0; j < st->nlev[i]; j++)
+            free(st->lev[i][j]);
+        if (st->nlev[i]) free(st->lev[i]);
+    }
+    free(st->cellv);
+    free(st->hash);
+}
 
 /*
- *  Genotype frequencies.
+ *  Returns the number of the cell with the given axis levels, adding
+ *  the cell if it is not already present.
  */
 
-    for (i = 0; i < nmrk; i++) {
+int find_cell (struct Strata *st, int *v)
+{
+    int i, c, h, oldsize, *oldhash;
+    unsigned int key;
+
+    if (2*(st->ncell + 1) > st->hsize) {
+        oldsize = st->hsize;
+        oldhash = st->hash;
+        st->hsize = oldsize ? 2*oldsize : 64;
+        st->hash = (int *) allocMem(st->hsize*sizeof(int));
+        for (h = 0; h < st->hsize; h++)
+            st->hash[h] = -1;
+        for (c = 0; c < st->ncell; c++) {
+            key = 0;
+            for (i = 0; i < naxis; i++)
+                key = key*0x9e3779b1U + st->cellv[c*naxis + i];
+            h = key & (st->hsize - 1);
+            while (st->hash[h] != -1)
+                h = (h + 1) & (st->hsize - 1);
+            st->hash[h] = c;
+        }
+        free(oldhash);
+    }
 
-        /* unaffected */
-	do_genotype_freqs(&mrk[i], 1, -1, fpg);
+    key = 0;
+    for (i = 0; i < naxis; i++)
+        key = key*0x9e3779b1U + v[i];
+    h = key & (st->hsize - 1);
+    while ((c = st->hash[h]) != -1) {
+        for (i = 0; i < naxis && st->cellv[c*naxis + i] == v[i]; i++) ;
+        if (i == naxis)
+            return c;
+        h = (h + 1) & (st->hsize - 1);
+    }
 
-        /* unaffected, by population */
-        for (j = 0; j < npop; j++) {
-	    do_genotype_freqs(&mrk[i], 1, j, fpg);
-        }
+    c = st->ncell++;
+    st->cellv = (int *) growMem(st->cellv, st->ncell*naxis*sizeof(int));
+    for (i = 0; i < naxis; i++)
+        st->cellv[c*naxis + i] = v[i];
+    st->hash[h] = c;
 
-        /* affected */
-	do_genotype_freqs(&mrk[i], 2, -1, fpg);
+    return c;
+}
 
-        /* affected, by population */
-        for (j = 0; j < npop; j++) {
-	    do_genotype_freqs(&mrk[i], 2, j, fpg);
-        }
+int find_level (struct Strata *st, int ax, char *name)
+{
+    int lev;
+
+    if ((lev = get_ndx(name, st->lev[ax], st->nlev[ax])) == -1)
+        lev = add_name(name, &st->lev[ax], &st->nlev[ax]);
+    return lev;
+}
+
+/*
+ *  The covariates file has one line per individual, giving the family
+ *  ID, the individual ID, and the individual's covariate level. Any
+ *  further fields are ignored.
+ */
 
-        /* by population */
-        for (j = 0; j < npop; j++) {
-	    do_genotype_freqs(&mrk[i], 0, j, fpg);
+void read_cov_file (char *covfile)
+{
+    int i, h, n, line, recsz;
+    char *rec, *recp, *save, *famid, *id, *key;
+    FILE *fp;
+
+    fp = fopen(covfile, "r");
+    if (!fp) {
+        fprintf(stderr, "cannot open covariates file %s\n", covfile);
+        exit(1);
+    }
+
+    recsz = 0;
+    line = 0;
+    while (read_record(fp, &rec, &recsz)) {
+        line++;
+        if (!(famid = strtok_r(rec, " \t\n", &save)))
+            continue;
+        if (!(id = strtok_r(NULL, " \t\n", &save)) ||
+                !(recp = strtok_r(NULL, " \t\n", &save))) {
+            fprintf(stderr, "%s: missing covariate, line %d\n", covfile,
+                    line);
+            exit(1);
         }
+        n = ncov;
+        key = (char *) allocMem(strlen(famid) + strlen(id) + 2);
+        sprintf(key, "%s\t%s", famid, id);
+        add_name(key, &covkey, &n);
+        add_name(recp, &covlev, &ncov);
+        free(key);
+    }
+    fclose(fp);
+    if (recsz) free(rec);
+
+    for (covhsize = 64; covhsize < 2*ncov; covhsize *= 2) ;
+    covhash = (int *) allocMem(covhsize*sizeof(int));
+    for (h = 0; h < covhsize; h++)
+        covhash[h] = -1;
+    for (i = 0; i < ncov; i++) {
+        h = hash_name(covkey[i]) & (covhsize - 1);
+        while (covhash[h] != -1)
+            h = (h + 1) & (covhsize - 1);
+        covhash[h] = i;
+    }
+}
+
+/*
+ *  Returns the covariate level of an individual, or NULL if the
+ *  individual is not in the covariates file.
+ */
 
-        /* everybody */
-	do_genotype_freqs(&mrk[i], 0, -1, fpg);
+char *find_cov (char *famid, char *id)
+{
+    int h;
+    char key[1024];
+
+    snprintf(key, sizeof(key), "%s\t%s", famid, id);
+    h = hash_name(key) & (covhsize - 1);
+    while (covhash[h] != -1) {
+        if (!strcmp(key, covkey[covhash[h]]))
+            return covlev[covhash[h]];
+        h = (h + 1) & (covhsize - 1);
     }
+
+    return 0;
 }
 
-void
-show_usage (char *prog)
+/*
+ *  FNV-1a hash of a string.
+ */
+
+unsigned int
+hash_name (char *str)
 {
-    printf("usage: %s [-M missval] locfile pedfile afrqout gfrqout\n\n", prog);
-    printf("   locfile      locus file\n");
-    printf("   pedfile      pedigree file\n");
-    printf("   afrqout      allele frequencies output file\n");
-    printf("   gfrqout      genotype frequencies output file\n");
-    printf("\n   options:\n");
-    printf("     -M missval   missing allele value in quotes\n");
-    exit(1);
+    unsigned int h = 2166136261u;
+
+    while (*str) {
+        h ^= (unsigned char) *str++;
+        h *= 16777619u;
+    }
+
+    return h;
 }
 
 void read_locus_file (char *locfile)
@@ -299,6 +789,12 @@ void read_locus_file (char *locfile)
         mrk[i].name = (char *) allocMem(strlen(rec));	/* rec contains \n */
         sscanf(rec, "%s", mrk[i].name);
         mrk[i].nall = 0;
+        mrk[i].nslot = 0;
+        mrk[i].ncell = 0;
+        mrk[i].cnt = 0;
+        mrk[i].ghash = 0;
+        mrk[i].nqc = 0;
+        mrk[i].qc = 0;
         while (fgets(rec, sizeof(rec), fp) &&
                sscanf(rec, "%s %s", buf, buf) == 2) ;
     }
@@ -306,13 +802,28 @@ void read_locus_file (char *locfile)
     fclose(fp);
 }
 
+/*
+ *  The pedigree file is divided into nthread byte ranges, each of which
+ *  begins at the start of a line, and the ranges are read and tallied
+ *  in parallel. Each range has its own population list and its own
+ *  copy of the marker count tables, with alleles indexed in the order
+ *  that they are first seen within that range; the allele names
+ *  themselves are shared (see dict). When all ranges have been read,
+ *  their allele and population names are entered, in file order, into
+ *  the global lists, and the counts are added into the global tables. Since every name is first seen in the same order as
+ *  it would be by a single reader, the output does not depend on the
+ *  number of threads. A pedigree file which is not a regular file, e.g.
+ *  a pipe, cannot be divided, and is read whole as the first range.
+ */
+
 void read_pedigree_file (char *pedfile, char *missval)
 {
-    char *recp, rec[10000];
-    int line = 0;
-    int famid, id, sex, aff, pop;
-    int i, j, k, l;
-    int *all[2];
+    int k, line;
+    int c;
+    off_t size, off;
+    struct Chunk *ck;
+    struct PedRead pr;
+    struct stat sb;
     FILE *fp;
 
     fp = fopen(pedfile, "r");
@@ -321,202 +832,656 @@ void read_pedigree_file (char *pedfile, char *missval)
         exit(1);
     }
 
-    all[0] = (int *) allocMem(nmrk*sizeof(int));
-    all[1] = (int *) allocMem(nmrk*sizeof(int));
-
-    while (fgets(rec, sizeof(rec), fp)) {
-        line++;
-/*
-    This way of reading the data file (using strtok) assumes that the
-    fields are ALWAYS separated by blanks or tabs.
-*/
-        if (!(recp = strtok(rec, " \t\n")))
-        {
-            fprintf(stderr, "%s: missing family ID, line %d\n", pedfile, line);
-            exit(1);
+    pr.pedfile = pedfile;
+    pr.missval = missval;
+    pr.chunk = (struct Chunk *) allocMem(nthread*sizeof(struct Chunk));
+    dict = (struct Dict *) allocMem((nmrk + 1)*sizeof(struct Dict));
+    for (k = 0; k < nmrk; k++)
+        dict[k].nall = 0;
+
+    size = -1;
+    if (!fstat(fileno(fp), &sb) && S_ISREG(sb.st_mode)
+            && !fseeko(fp, 0, SEEK_END))
+        size = ftello(fp);
+    pr.chunk[0].start = 0;
+    if (size < 0) {
+        pr.chunk[0].end = -1;
+        for (k = 1; k < nthread; k++)
+            pr.chunk[k].start = pr.chunk[k].end = 0;
+    }
+    else {
+        for (k = 1; k < nthread; k++) {
+            off = size*k/nthread;
+            if (off <= pr.chunk[k-1].start)
+                off = pr.chunk[k-1].start;
+            else {
+                fseeko(fp, off - 1, SEEK_SET);
+                while ((c = getc(fp)) != EOF && c != '\n') ;
+                off = ftello(fp);
+            }
+            pr.chunk[k].start = off;
+            pr.chunk[k-1].end = off;
         }
-        if ((famid = get_ndx(recp, famids, nfamid)) == -1)
-            famid = add_name(recp, &famids, &nfamid);
+        pr.chunk[nthread-1].end = size;
+    }
+    fclose(fp);
 
-        if (!(recp = strtok(NULL, " \t\n")))
-        {
-            fprintf(stderr, "%s: missing ID, line %d\n", pedfile, line);
-            exit(1);
-        }
-        if ((id = get_ndx(recp, ids, nid)) == -1)
-            id = add_name(recp, &ids, &nid);
+    run_tasks(nthread, nthread, count_chunk, &pr);
 
-        if (!(recp = strtok(NULL, " \t\n")))
-        {
-            fprintf(stderr, "%s: missing affection status, line %d\n", pedfile,
-                    line);
+    /* report the first error in the file, if any */
+    line = 0;
+    for (k = 0; k < nthread; k++) {
+        ck = &pr.chunk[k];
+        if (ck->errline == -1) {
+            fprintf(stderr, "%s\n", ck->errmsg[0]);
             exit(1);
         }
-        if (!strcmp(recp, "U") || !strcmp(recp, "u") || !strcmp(recp, "1"))
-            aff = 1;
-        else if (!strcmp(recp, "A") || !strcmp(recp, "a") || !strcmp(recp, "2"))
-            aff = 2;
-        else
-        {
-            fprintf(stderr,
-    "%s: invalid affection status [%s], line %d: must be coded U/A or 1/2\n",
-                    pedfile, recp, line);
+        if (ck->errline) {
+            fprintf(stderr, "%sline %d%s\n", ck->errmsg[0], line + ck->errline,
+                    ck->errmsg[1]);
             exit(1);
         }
+        line += ck->nline;
+    }
 
-        if (!(recp = strtok(NULL, " \t\n")))
-        {
-            fprintf(stderr, "%s: missing population identifier, line %d\n",
-                    pedfile, line);
+    /* the per-individual QC lines are written in file order */
+    if (qcout) {
+        fp = open_qc("iqc");
+        for (k = 0; k < nthread; k++) {
+            ck = &pr.chunk[k];
+            fwrite(ck->iqc, 1, ck->iqclen, fp);
+            if (ck->iqcsz) free(ck->iqc);
+        }
+        if (fclose(fp)) {
+            fprintf(stderr, "error writing %s.iqc\n", qcout);
             exit(1);
         }
+    }
 
-        if ((pop = get_ndx(recp, pops, npop)) == -1) {
-            if (npop == MXPOP) {
-                fprintf(stderr, "too many populations, MXPOP = %d\n", MXPOP);
-                exit(1);
-            }
+    /* add the counts for each range into the global tables */
+    for (k = 0; k < nthread; k++)
+        merge_chunk(&pr.chunk[k]);
+    free(pr.chunk);
 
-            pop = add_name(recp, &pops, &npop);
-            for (j = 0; j < nmrk; j++) {
-                for (k = 0; k < MXALL; k++) {
-                    mrk[j].pop[pop].acntu[k] = 0;
-                    mrk[j].pop[pop].acnta[k] = 0;
-                    for (l = 0; l < MXALL; l++) {
-                        mrk[j].pop[pop].gcnta[k][l] = 0;
-                        mrk[j].pop[pop].gcnta[l][k] = 0;
-                        mrk[j].pop[pop].gcntu[k][l] = 0;
-                        mrk[j].pop[pop].gcntu[l][k] = 0;
-                    }
-                }
-            }
-        }
+    /* the names now belong to the global allele lists */
+    for (k = 0; k < nmrk; k++) {
+        if (dict[k].nall) free(dict[k].alleles);
+    }
+    free(dict);
+}
 
-        if (!(recp = strtok(NULL, " \t\n")))
-        {
-            fprintf(stderr, "%s: missing sex code, line %d\n", pedfile, line);
-            exit(1);
-        }
-        if (!strcmp(recp, "M") || !strcmp(recp, "m") || !strcmp(recp, "1"))
-            sex = 1;
-        else if (!strcmp(recp, "F") || !strcmp(recp, "f") || !strcmp(recp, "2"))
-            sex = 2;
-        else
-        {
-            fprintf(stderr,
-            "%s: invalid sex code [%s], line %d: must be coded M/F or 1/2\n",
-                    pedfile, recp, line);
-            exit(1);
-        }
+/*
+ *  Add the counts in a chunk into the global tables. The chunk's axis
+ *  levels, cells and allele names are entered into the global lists in
+ *  the order in which they occur in the chunk. The chunk is freed; the
+ *  global lists take over the allele names that they do not have yet.
+ */
 
-        /* read in the marker alleles */
-        for (i = 0; i < nmrk; i++) {
-            if (!(recp = strtok(NULL, " \t\n")))
-            {
-                fprintf(stderr, "%s: missing allele, marker %s, line %d\n",
-                        pedfile, mrk[i].name, line);
-                exit(1);
-            }
-            if (!strcmp(recp, missval))
-            {
-                all[0][i] = -1;
-            }
-            else if ((all[0][i] =
-                 get_ndx(recp, mrk[i].alleles, mrk[i].nall)) == -1)
-            {
-                all[0][i] = add_name(recp, &mrk[i].alleles, &mrk[i].nall);
-            }
+void
+merge_chunk (struct Chunk *ck)
+{
+    int i, j, c, maxcell, *amap, *cmap;
+    int *lmap[MXAXIS], v[MXAXIS];
+    char *name;
+
+    for (i = 0; i < naxis; i++) {
+        lmap[i] = (int *) allocMem((ck->st.nlev[i] + 1)*sizeof(int));
+        for (j = 0; j < ck->st.nlev[i]; j++)
+            lmap[i][j] = find_level(&strata, i, ck->st.lev[i][j]);
+    }
 
-            if (!(recp = strtok(NULL, " \t\n")))
-            {
-                fprintf(stderr, "%s: missing allele, marker %s, line %d\n",
-                        pedfile, mrk[i].name, line);
-                exit(1);
-            }
-            if (!strcmp(recp, missval))
-            {
-                all[1][i] = -1;
-            }
-            else if ((all[1][i] =
-                 get_ndx(recp, mrk[i].alleles, mrk[i].nall)) == -1)
-            {
-                all[1][i] = add_name(recp, &mrk[i].alleles, &mrk[i].nall);
-            }
+    cmap = (int *) allocMem((ck->st.ncell + 1)*sizeof(int));
+    for (c = 0; c < ck->st.ncell; c++) {
+        for (i = 0; i < naxis; i++)
+            v[i] = lmap[i][ck->st.cellv[c*naxis + i]];
+        cmap[c] = find_cell(&strata, v);
+    }
 
-            if (mrk[i].nall > MXALL) {
-                fprintf(stderr, "marker %s has too many alleles, MXALL = %d\n",
-                        mrk[i].name, MXALL);
-                exit(1);
-            }
+    amap = 0;
+    for (i = 0; i < nmrk; i++) {
+        amap = (int *) growMem(amap, (ck->mrk[i].nall + 1)*sizeof(int));
+        for (j = 0; j < ck->mrk[i].nall; j++) {
+            name = ck->mrk[i].alleles[j];
+            if ((amap[j] = get_ndx(name, mrk[i].alleles, mrk[i].nall)) == -1)
+                amap[j] = add_allele(name, &mrk[i].alleles, &mrk[i].nall);
+            else if (!ck->shared)
+                free(name);
         }
 
-        /* count marker alleles and genotypes */
-        for (i = 0; i < nmrk; i++) {
-            if (all[0][i] != -1) {
-                if (aff == 2)
-                    mrk[i].pop[pop].acnta[all[0][i]]++;
-                else
-                    mrk[i].pop[pop].acntu[all[0][i]]++;
-            }
-            if (all[1][i] != -1) {
-                if (aff == 2)
-                    mrk[i].pop[pop].acnta[all[1][i]]++;
-                else
-                    mrk[i].pop[pop].acntu[all[1][i]]++;
+        maxcell = 0;
+        for (c = 0; c < ck->mrk[i].ncell; c++) {
+            if (cmap[c] >= maxcell) maxcell = cmap[c] + 1;
+        }
+        if (mrk[i].nall > mrk[i].nslot || maxcell > mrk[i].ncell)
+            grow_counts(&mrk[i], mrk[i].nall, maxcell);
+
+        merge_counts(&mrk[i], &ck->mrk[i], amap, cmap);
+
+        if (ck->mrk[i].nqc) {
+            maxcell = 0;
+            for (c = 0; c < ck->mrk[i].nqc; c++) {
+                if (cmap[c] >= maxcell) maxcell = cmap[c] + 1;
             }
-            if (all[0][i] != -1 && all[1][i] != -1) {
-                if (aff == 2)
-                    mrk[i].pop[pop].gcnta[all[0][i]][all[1][i]]++;
-                else
-                    mrk[i].pop[pop].gcntu[all[0][i]][all[1][i]]++;
+            if (maxcell > mrk[i].nqc)
+                grow_qc(&mrk[i], maxcell);
+            for (c = 0; c < ck->mrk[i].nqc; c++) {
+                for (j = 0; j < NQC; j++)
+                    mrk[i].qc[cmap[c]*NQC + j] += ck->mrk[i].qc[c*NQC + j];
             }
         }
+        free_counts(&ck->mrk[i]);
     }
 
-    fclose(fp);
+    free(amap);
+    free(cmap);
+    for (i = 0; i < naxis; i++)
+        free(lmap[i]);
+    free_strata(&ck->st);
+    free(ck->mrk);
+}
+
+/*
+ *  Read and tally the lines in one byte range of the pedigree file.
+ */
+
+void
+count_chunk (int k, void *arg)
+{
+    struct PedRead *pr = (struct PedRead *) arg;
+    struct Chunk *ck = &pr->chunk[k];
+    int i, len, recsz;
+    int *all[2];
+    off_t pos;
+    char *rec;
+    FILE *fp;
 
+    ck->nline = 0;
+    ck->shared = 1;
+    ck->errline = 0;
+    init_strata(&ck->st);
+    ck->mrk = (struct Marker *) allocMem(nmrk*sizeof(struct Marker));
     for (i = 0; i < nmrk; i++) {
-        mrk[i].all_sort = (int *) allocMem(mrk[i].nall*sizeof(int));
-        sort_names(mrk[i].alleles, mrk[i].nall, mrk[i].all_sort);
+        ck->mrk[i].name = mrk[i].name;
+        ck->mrk[i].nall = 0;
+        ck->mrk[i].nslot = 0;
+        ck->mrk[i].ncell = 0;
+        ck->mrk[i].cnt = 0;
+        ck->mrk[i].ghash = 0;
+        ck->mrk[i].nqc = 0;
+        ck->mrk[i].qc = 0;
     }
-}
+    ck->iqc = 0;
+    ck->iqcsz = 0;
+    ck->iqclen = 0;
 
-void do_allele_freqs (struct Marker *m, int do_aff, int do_pop, FILE *fp)
-{
-    int j, k, kk, tsum, fnd, nfrq;
-    double sum, num, asum;
-    char affect, *popid, buf[10];
-
-    switch (do_aff) {
-    case 0:
-	affect = '-';
-        break;
-    case 1:
-	affect = 'U';
-        break;
-    case 2:
-	affect = 'A';
-        break;
-    }
-
-    if (do_pop == -1)
-        popid = "-";
-    else
-        popid = pops[do_pop];
+    if (ck->start == ck->end)
+        return;
 
-    nfrq = 0;
-    sum = 0;
-    for (k = 0; k < m->nall; k++) {
-        fnd = 0;
-        for (j = 0; j < npop; j++) {
-            if (do_pop >= 0 && j != do_pop) continue;
-            if (do_aff != 2 && m->pop[j].acntu[k]) {
-                fnd = 1;
-                sum += m->pop[j].acntu[k];
-            }
-            if (do_aff != 1 && m->pop[j].acnta[k]) {
+    fp = fopen(pr->pedfile, "r");
+    if (!fp) {
+        ck->errline = -1;
+        snprintf(ck->errmsg[0], sizeof(ck->errmsg[0]),
+                 "cannot open pedigree file %s", pr->pedfile);
+        *ck->errmsg[1] = 0;
+        return;
+    }
+    if (ck->start)
+        fseeko(fp, ck->start, SEEK_SET);
+
+    all[0] = (int *) allocMem(nmrk*sizeof(int));
+    all[1] = (int *) allocMem(nmrk*sizeof(int));
+
+    recsz = 0;
+    pos = ck->start;
+    while ((ck->end < 0 || pos < ck->end)
+           && (len = read_record(fp, &rec, &recsz))) {
+        pos += len;
+        ck->nline++;
+        if (tally_record(ck, rec, pr->pedfile, pr->missval, all))
+            break;
+    }
+
+    fclose(fp);
+    if (recsz) free(rec);
+    free(all[0]);
+    free(all[1]);
+}
+
+/*
+ *  Tally the alleles and genotypes of one individual. Returns non-zero,
+ *  with the error recorded in the chunk, if the line is invalid.
+ */
+
+int
+tally_record (struct Chunk *ck, char *rec, char *pedfile, char *missval,
+                  int **all)
+{
+    char *recp, *save, *famid, *id, *pop, *cov;
+    char site[256], *line;
+    int sex, aff, cell, q, len, nq[NQC];
+    int i, v[MXAXIS];
+    struct Marker *m;
+
+/*
+    This way of reading the data file (using strtok) assumes that the
+    fields are ALWAYS separated by blanks or tabs.
+*/
+    if (!(famid = strtok_r(rec, " \t\n", &save)))
+        return chunk_error(ck, "", "%s: missing family ID, ", pedfile);
+
+    if (!(id = strtok_r(NULL, " \t\n", &save)))
+        return chunk_error(ck, "", "%s: missing ID, ", pedfile);
+
+    if (!(recp = strtok_r(NULL, " \t\n", &save)))
+        return chunk_error(ck, "", "%s: missing affection status, ",
+                           pedfile);
+    if (!strcmp(recp, "U") || !strcmp(recp, "u") || !strcmp(recp, "1"))
+        aff = 1;
+    else if (!strcmp(recp, "A") || !strcmp(recp, "a") || !strcmp(recp, "2"))
+        aff = 2;
+    else
+        return chunk_error(ck, ": must be coded U/A or 1/2",
+                           "%s: invalid affection status [%s], ", pedfile, recp);
+
+    if (!(pop = strtok_r(NULL, " \t\n", &save)))
+        return chunk_error(ck, "", "%s: missing population identifier, ",
+                           pedfile);
+
+    if (!(recp = strtok_r(NULL, " \t\n", &save)))
+        return chunk_error(ck, "", "%s: missing sex code, ", pedfile);
+    if (!strcmp(recp, "M") || !strcmp(recp, "m") || !strcmp(recp, "1"))
+        sex = 1;
+    else if (!strcmp(recp, "F") || !strcmp(recp, "f") || !strcmp(recp, "2"))
+        sex = 2;
+    else
+        return chunk_error(ck, ": must be coded M/F or 1/2",
+                           "%s: invalid sex code [%s], ", pedfile, recp);
+
+    /* find the individual's cell */
+    for (i = 0; i < naxis; i++) {
+        switch (axis[i].type) {
+        case AX_AFF:
+            v[i] = aff - 1;
+            break;
+        case AX_SEX:
+            v[i] = sex - 1;
+            break;
+        case AX_POP:
+            v[i] = find_level(&ck->st, i, pop);
+            break;
+        case AX_SITE:
+            snprintf(site, sizeof(site), "%.*s", axis[i].len, famid);
+            v[i] = find_level(&ck->st, i, site);
+            break;
+        case AX_COV:
+            if (!(cov = find_cov(famid, id)))
+                return chunk_error(ck, "",
+                        "%s: individual %s %s not in covariates file, ",
+                                   pedfile, famid, id);
+            v[i] = find_level(&ck->st, i, cov);
+            break;
+        }
+    }
+    cell = find_cell(&ck->st, v);
+
+    /* read in the marker alleles */
+    for (i = 0; i < nmrk; i++) {
+        m = &ck->mrk[i];
+
+        if (!(recp = strtok_r(NULL, " \t\n", &save)))
+            return chunk_error(ck, "", "%s: missing allele, marker %s, ",
+                               pedfile, m->name);
+        if (!strcmp(recp, missval))
+            all[0][i] = -1;
+        else if ((all[0][i] = get_ndx(recp, m->alleles, m->nall)) == -1)
+            all[0][i] = add_allele(intern_allele(i, recp), &m->alleles,
+                                   &m->nall);
+
+        if (!(recp = strtok_r(NULL, " \t\n", &save)))
+            return chunk_error(ck, "", "%s: missing allele, marker %s, ",
+                               pedfile, m->name);
+        if (!strcmp(recp, missval))
+            all[1][i] = -1;
+        else if ((all[1][i] = get_ndx(recp, m->alleles, m->nall)) == -1)
+            all[1][i] = add_allele(intern_allele(i, recp), &m->alleles,
+                                   &m->nall);
+
+        if (m->nall > m->nslot || cell >= m->ncell)
+            grow_counts(m, m->nall, cell + 1);
+        if (qcout && cell >= m->nqc)
+            grow_qc(m, cell + 1);
+    }
+
+    /* count marker alleles and genotypes */
+    for (i = 0; i < nmrk; i++) {
+        m = &ck->mrk[i];
+        if (all[0][i] != -1)
+            count_allele(m, cell, all[0][i], 1);
+        if (all[1][i] != -1)
+            count_allele(m, cell, all[1][i], 1);
+        if (all[0][i] != -1 && all[1][i] != -1)
+            count_genotype(m, cell, all[0][i], all[1][i], 1);
+    }
+
+    if (!qcout)
+        return 0;
+
+    /* tally missing alleles and heterozygotes, by marker and by individual */
+    for (q = 0; q < NQC; q++)
+        nq[q] = 0;
+    for (i = 0; i < nmrk; i++) {
+        m = &ck->mrk[i];
+        q = (all[0][i] == -1) + (all[1][i] == -1);	/* Q_TYPED..Q_MISS */
+        m->qc[cell*NQC + q]++;
+        nq[q]++;
+        if (!q && all[0][i] != all[1][i]) {
+            m->qc[cell*NQC + Q_HET]++;
+            nq[Q_HET]++;
+        }
+    }
+
+    len = strlen(famid) + strlen(id) + 80;
+    if (ck->iqclen + len > ck->iqcsz) {
+        ck->iqcsz = 2*ck->iqcsz + len + 4096;
+        ck->iqc = (char *) growMem(ck->iqc, ck->iqcsz);
+    }
+    line = ck->iqc + ck->iqclen;
+    sprintf(line, "%s %s %d %d %d %7.5f ", famid, id, nq[Q_TYPED],
+            nq[Q_HALF], nq[Q_MISS], nmrk ? (nmrk - nq[Q_TYPED])/(double) nmrk
+                                         : 0.);
+    if (nq[Q_TYPED])
+        sprintf(line + strlen(line), "%d %7.5f\n", nq[Q_HET],
+                nq[Q_HET]/(double) nq[Q_TYPED]);
+    else
+        sprintf(line + strlen(line), "%d -\n", nq[Q_HET]);
+    ck->iqclen += strlen(line);
+
+    return 0;
+}
+
+/*
+ *  Record an error on the current line of a chunk. The message is kept
+ *  in two parts, the text before and the text after the line number,
+ *  since the line number within the whole file is not known until all
+ *  preceding chunks have been read. Always returns 1.
+ */
+
+int
+chunk_error (struct Chunk *ck, char *post, char *fmt, ...)
+{
+    va_list ap;
+
+    ck->errline = ck->nline;
+    va_start(ap, fmt);
+    vsnprintf(ck->errmsg[0], sizeof(ck->errmsg[0]), fmt, ap);
+    va_end(ap);
+    snprintf(ck->errmsg[1], sizeof(ck->errmsg[1]), "%s", post);
+
+    return 1;
+}
+
+/*
+ *  Add the counts of one marker from a chunk into the global tables,
+ *  mapping the chunk's allele and cell indices to global ones.
+ */
+
+void
+merge_counts (struct Marker *dst, struct Marker *src, int *amap, int *cmap)
+{
+    int c, cell, a, b, n;
+
+    for (c = 0; c < src->ncell; c++) {
+        cell = cmap[c];
+        for (a = 0; a < src->nall; a++) {
+            if ((n = acount(src, c, a)))
+                count_allele(dst, cell, amap[a], n);
+            for (b = 0; b <= a; b++) {
+                if ((n = gcount(src, c, a, b)))
+                    count_genotype(dst, cell, amap[a], amap[b], n);
+            }
+        }
+    }
+}
+
+/*
+ *  Free the counts of a marker, and its list of allele names, but not
+ *  the names, which are shared or have been handed on by merge_chunk.
+ */
+
+void
+free_counts (struct Marker *m)
+{
+    if (m->nall) free(m->alleles);
+    if (m->cnt) free(m->cnt);
+    if (m->qc) free(m->qc);
+    if (m->ghash) {
+        if (m->ghash->size) {
+            free(m->ghash->key);
+            free(m->ghash->cnt);
+        }
+        free(m->ghash);
+    }
+}
+
+/*
+ *  List the strata for which counts are written, and the cells in each,
+ *  returning the number of strata. A stratum gives, for each axis,
+ *  either one level or all levels ("-"). The strata are listed in
+ *  odometer order with the first axis varying slowest; on the first
+ *  axis, "all levels" comes after the levels, on the others, before
+ *  them. The stratum which is "all levels" on every axis, i.e. the whole
+ *  sample, is last. For the default axes, affection status and
+ *  population, this gives the order U/-, U/pops, A/-, A/pops, -/pops,
+ *  -/-. Each label holds the level names, each preceded by a blank.
+ */
+
+int
+list_strata (char ***labelp, int ***cellsp, int **ncellsp)
+{
+    int i, j, k, c, n, nstr, ncl, done;
+    int v[MXAXIS], first[MXAXIS];
+    int *ncells, **cells;
+    char **label;
+
+    nstr = 1;
+    for (i = 0; i < naxis; i++)
+        nstr *= strata.nlev[i] + 1;
+    label = (char **) allocMem(nstr*sizeof(char *));
+    ncells = (int *) allocMem(nstr*sizeof(int));
+    cells = (int **) allocMem(nstr*sizeof(int *));
+
+    for (i = 0; i < naxis; i++)
+        v[i] = first[i] = i ? -1 : (strata.nlev[0] ? 0 : -1);
+
+    n = 0;
+    done = 0;
+    while (!done) {
+        for (i = 0; i < naxis && v[i] == -1; i++) ;
+        k = i == naxis ? nstr - 1 : n++;
+
+        ncl = 0;
+        cells[k] = (int *) allocMem((strata.ncell + 1)*sizeof(int));
+        for (c = 0; c < strata.ncell; c++) {
+            for (i = 0; i < naxis; i++) {
+                if (v[i] != -1 && v[i] != strata.cellv[c*naxis + i])
+                    break;
+            }
+            if (i == naxis)
+                cells[k][ncl++] = c;
+        }
+        ncells[k] = ncl;
+
+        j = 0;
+        for (i = 0; i < naxis; i++)
+            j += strlen(v[i] == -1 ? "-" : strata.lev[i][v[i]]) + 1;
+        label[k] = (char *) allocMem(j + 1);
+        *label[k] = 0;
+        for (i = 0; i < naxis; i++) {
+            strcat(label[k], " ");
+            strcat(label[k], v[i] == -1 ? "-" : strata.lev[i][v[i]]);
+        }
+
+        /* advance the odometer */
+        for (i = naxis - 1; i >= 0; i--) {
+            if (i == 0) {
+                if (v[0] == -1)
+                    done = 1;
+                else if (++v[0] == strata.nlev[0])
+                    v[0] = -1;
+                break;
+            }
+            if (++v[i] < strata.nlev[i])
+                break;
+            v[i] = first[i];
+        }
+    }
+
+    *labelp = label;
+    *cellsp = cells;
+    *ncellsp = ncells;
+    return nstr;
+}
+
+/*
+ *  Write the allele and genotype frequencies for every stratum.
+ */
+
+void write_freqs (FILE *fpa, FILE *fpg)
+{
+    int i, k, nstr;
+    int *ncells, **cells;
+    char **label;
+
+    nstr = list_strata(&label, &cells, &ncells);
+
+/*
+ *  For each locus, sum up allele counts, then divide to get frequencies.
+ *  Force the frequencies into a fixed-width format, sum the first N - 1
+ *  formatted frequencies where N = #alleles, and subtract this sum from
+ *  1 to get the frequency of the Nth allele. This makes the frequencies
+ *  sum to 1.
+ */
+
+    for (i = 0; i < nmrk; i++) {
+        for (k = 0; k < nstr; k++)
+	    do_allele_freqs(&mrk[i], label[k], cells[k], ncells[k], fpa);
+    }
+
+
+/*
+ *  Genotype frequencies.
+ */
+
+    for (i = 0; i < nmrk; i++) {
+        for (k = 0; k < nstr; k++)
+	    do_genotype_freqs(&mrk[i], label[k], cells[k], ncells[k], fpg);
+    }
+
+    for (k = 0; k < nstr; k++) {
+        free(label[k]);
+        free(cells[k]);
+    }
+    free(label);
+    free(cells);
+    free(ncells);
+}
+
+/*
+ *  Write the per-marker QC table, prefix.mqc: for each marker and
+ *  stratum, the number of individuals, the numbers with both alleles
+ *  typed, with one allele missing, and with both missing, the fraction
+ *  not fully typed, and the number and fraction of typed individuals
+ *  who are heterozygous.
+ */
+
+void
+write_mqc (char *prefix)
+{
+    int i, j, k, q, n, nstr, nq[NQC];
+    int *ncells, **cells;
+    char **label;
+    struct Marker *m;
+    FILE *fp;
+
+    fp = open_qc("mqc");
+    nstr = list_strata(&label, &cells, &ncells);
+
+    for (i = 0; i < nmrk; i++) {
+        m = &mrk[i];
+        for (k = 0; k < nstr; k++) {
+            for (q = 0; q < NQC; q++)
+                nq[q] = 0;
+            for (j = 0; j < ncells[k]; j++) {
+                if (cells[k][j] < m->nqc) {
+                    for (q = 0; q < NQC; q++)
+                        nq[q] += m->qc[cells[k][j]*NQC + q];
+                }
+            }
+            n = nq[Q_TYPED] + nq[Q_HALF] + nq[Q_MISS];
+            if (!n)
+                continue;
+            fprintf(fp, "%s%s %d %d %d %d %7.5f ", m->name, label[k], n,
+                    nq[Q_TYPED], nq[Q_HALF], nq[Q_MISS],
+                    (n - nq[Q_TYPED])/(double) n);
+            if (nq[Q_TYPED])
+                fprintf(fp, "%d %7.5f\n", nq[Q_HET],
+                        nq[Q_HET]/(double) nq[Q_TYPED]);
+            else
+                fprintf(fp, "%d -\n", nq[Q_HET]);
+        }
+    }
+
+    if (fclose(fp)) {
+        fprintf(stderr, "error writing %s.mqc\n", prefix);
+        exit(1);
+    }
+
+    for (k = 0; k < nstr; k++) {
+        free(label[k]);
+        free(cells[k]);
+    }
+    free(label);
+    free(cells);
+    free(ncells);
+}
+
+/*
+ *  Open the QC output file with the given extension.
+ */
+
+FILE *
+open_qc (char *ext)
+{
+    char *file;
+    FILE *fp;
+
+    file = (char *) allocMem(strlen(qcout) + strlen(ext) + 2);
+    sprintf(file, "%s.%s", qcout, ext);
+    fp = fopen(file, "w");
+    if (!fp) {
+        fprintf(stderr, "cannot open %s\n", file);
+        exit(1);
+    }
+    free(file);
+
+    return fp;
+}
+
+void do_allele_freqs (struct Marker *m, char *label, int *cells, int ncl,
+                      FILE *fp)
+{
+    int j, k, kk, cnt, tsum, fnd, nfrq;
+    double sum, num, asum;
+    char buf[10];
+
+    nfrq = 0;
+    sum = 0;
+    for (k = 0; k < m->nall; k++) {
+        fnd = 0;
+        for (j = 0; j < ncl; j++) {
+            if ((cnt = acount(m, cells[j], k))) {
                 fnd = 1;
-                sum += m->pop[j].acnta[k];
+                sum += cnt;
             }
         }
         if (fnd) nfrq++;
@@ -526,143 +1491,700 @@ void do_allele_freqs (struct Marker *m, int do_aff, int do_pop, FILE *fp)
     for (k = 0; nfrq && k < m->nall; k++) {
         kk = m->all_sort[k];
         tsum = 0;
-        for (j = 0; j < npop; j++) {
-            if (do_pop >= 0 && j != do_pop) continue;
-            if (do_aff != 2)
-                tsum += m->pop[j].acntu[kk];
-            if (do_aff != 1)
-                tsum += m->pop[j].acnta[kk];
-        }
+        for (j = 0; j < ncl; j++)
+            tsum += acount(m, cells[j], kk);
         if (tsum) {
             nfrq--;
             if (nfrq) {
                 sprintf(buf, "%7.5f", tsum/sum);
                 sscanf(buf, "%lf", &num);
                 asum += num;
-                fprintf(fp, "%s %c %s %s %d %7.5f\n", m->name, affect, popid,
+                fprintf(fp, "%s%s %s %d %7.5f\n", m->name, label,
                         m->alleles[kk], tsum, num);
             }
             else
-                fprintf(fp, "%s %c %s %s %d %7.5f\n", m->name, affect, popid,
+                fprintf(fp, "%s%s %s %d %7.5f\n", m->name, label,
                         m->alleles[kk], tsum, 1. - asum);
         }
     }
 }
 
-void do_genotype_freqs (struct Marker *m, int do_aff, int do_pop, FILE *fp)
+void do_genotype_freqs (struct Marker *m, char *label, int *cells, int ncl,
+                        FILE *fp)
 {
-    int j, k, kk, l, ll, tsum, fnd, nfrq;
+    int j, k, kk, l, ll, cnt, tsum, fnd, nfrq;
     double sum, num, asum;
-    char affect, *popid, buf[10];
-
-    switch (do_aff) {
-    case 0:
-	affect = '-';
-        break;
-    case 1:
-	affect = 'U';
-        break;
-    case 2:
-	affect = 'A';
-        break;
-    }
-
-    if (do_pop == -1)
-        popid = "-";
-    else
-        popid = pops[do_pop];
+    char buf[10];
 
     nfrq = 0;
     sum = 0;
     for (k = 0; k < m->nall; k++) {
-        for (l = 0; l < k; l++) {
+        for (l = 0; l <= k; l++) {
             fnd = 0;
-            for (j = 0; j < npop; j++) {
-                if (do_pop >= 0 && j != do_pop) continue;
-                if (do_aff != 2 &&
-                    (m->pop[j].gcntu[k][l] || m->pop[j].gcntu[l][k]))
-                {
-                    fnd = 1;
-                    sum += m->pop[j].gcntu[k][l] + m->pop[j].gcntu[l][k];
-                }
-                if (do_aff != 1 &&
-                    (m->pop[j].gcnta[k][l] || m->pop[j].gcnta[l][k]))
-                {
+            for (j = 0; j < ncl; j++) {
+                if ((cnt = gcount(m, cells[j], k, l))) {
                     fnd = 1;
-                    sum += m->pop[j].gcnta[k][l] + m->pop[j].gcnta[l][k];
+                    sum += cnt;
                 }
             }
             if (fnd) nfrq++;
         }
-
-        fnd = 0;
-        for (j = 0; j < npop; j++) {
-            if (do_pop >= 0 && j != do_pop) continue;
-            if (do_aff != 2 && m->pop[j].gcntu[k][k]) {
-                fnd = 1;
-                sum += m->pop[j].gcntu[k][k];
-            }
-            if (do_aff != 1 && m->pop[j].gcnta[k][k]) {
-                fnd = 1;
-                sum += m->pop[j].gcnta[k][k];
-            }
-        }
-        if (fnd) nfrq++;
     }
 
     asum = 0;
     for (k = 0; nfrq && k < m->nall; k++) {
         kk = m->all_sort[k];
-        for (l = 0; nfrq && l < k; l++) {
+        for (l = 0; nfrq && l <= k; l++) {
             ll = m->all_sort[l];
             tsum = 0;
-            for (j = 0; j < npop; j++) {
-                if (do_pop >= 0 && j != do_pop) continue;
-                if (do_aff != 2)
-                    tsum += m->pop[j].gcntu[kk][ll] + m->pop[j].gcntu[ll][kk];
-                if (do_aff != 1)
-                    tsum += m->pop[j].gcnta[kk][ll] + m->pop[j].gcnta[ll][kk];
-            }
+            for (j = 0; j < ncl; j++)
+                tsum += gcount(m, cells[j], kk, ll);
             if (tsum) {
                 nfrq--;
                 if (nfrq) {
                     sprintf(buf, "%7.5f", tsum/sum);
                     sscanf(buf, "%lf", &num);
                     asum += num;
-                    fprintf(fp, "%s %c %s %s %s %d %7.5f\n", m->name,
-                            affect, popid, m->alleles[ll], m->alleles[kk],
-                            tsum, num);
+                    fprintf(fp, "%s%s %s %s %d %7.5f\n", m->name, label,
+                            m->alleles[ll], m->alleles[kk], tsum, num);
                 }
                 else
-                    fprintf(fp, "%s %c %s %s %s %d %7.5f\n", m->name,
-                            affect, popid, m->alleles[ll], m->alleles[kk],
-                            tsum, 1. - asum);
+                    fprintf(fp, "%s%s %s %s %d %7.5f\n", m->name, label,
+                            m->alleles[ll], m->alleles[kk], tsum,
+                            1. - asum);
             }
         }
+    }
+}
 
-        tsum = 0;
-        for (j = 0; j < npop; j++) {
-            if (do_pop >= 0 && j != do_pop) continue;
-            if (do_aff != 2)
-                tsum += m->pop[j].gcntu[kk][kk];
-            if (do_aff != 1)
-                tsum += m->pop[j].gcnta[kk][kk];
+/*
+ *  Make room in a marker's QC counts for ncell cells.
+ */
+
+void
+grow_qc (struct Marker *m, int ncell)
+{
+    int c;
+
+    m->qc = (int *) growMem(m->qc, ncell*NQC*sizeof(int));
+    for (c = m->nqc*NQC; c < ncell*NQC; c++)
+        m->qc[c] = 0;
+    m->nqc = ncell;
+}
+
+/*
+ *  Make room in a marker's count tables for nall alleles and ncell
+ *  cells. The allele and genotype counts for each cell are stored
+ *  together in one block, and the blocks for all cells are contiguous.
+ *  Once a marker has more than HASHALL alleles, its genotype counts are
+ *  moved to a hash table, since most genotypes of a highly polymorphic
+ *  marker are never observed.
+ */
+
+void
+grow_counts (struct Marker *m, int nall, int ncell)
+{
+    int c, k, l, nslot, nk, oldsz, newsz, *cnt;
+
+    nslot = m->nslot;
+    if (nall > nslot) {
+        if (!nslot) nslot = 2;
+        while (nslot < nall)
+            nslot *= 2;
+    }
+    if (ncell < m->ncell)
+        ncell = m->ncell;
+
+    oldsz = m->nslot + (m->ghash ? 0 : TRI(m->nslot,0));
+
+    if (nslot > HASHALL && !m->ghash) {
+        m->ghash = (struct GHash *) allocMem(sizeof(struct GHash));
+        m->ghash->size = 0;
+        m->ghash->nused = 0;
+        nk = m->nall < m->nslot ? m->nall : m->nslot;
+        for (c = 0; c < m->ncell; c++) {
+            for (k = 0; k < nk; k++) {
+                for (l = 0; l <= k; l++) {
+                    if (m->cnt[c*oldsz + m->nslot + TRI(k,l)])
+                        *ghash_slot(m->ghash, (long) c << 32 | TRI(k,l), 1) =
+                            m->cnt[c*oldsz + m->nslot + TRI(k,l)];
+                }
+            }
         }
-        if (tsum) {
-            nfrq--;
-            if (nfrq) {
-                sprintf(buf, "%7.5f", tsum/sum);
-                sscanf(buf, "%lf", &num);
-                asum += num;
-                fprintf(fp, "%s %c %s %s %s %d %7.5f\n", m->name, affect,
-                        popid, m->alleles[kk], m->alleles[kk], tsum, num);
+    }
+
+    newsz = nslot + (m->ghash ? 0 : TRI(nslot,0));
+
+    cnt = (int *) allocMem(ncell*newsz*sizeof(int));
+    for (c = 0; c < ncell*newsz; c++)
+        cnt[c] = 0;
+    for (c = 0; c < m->ncell; c++) {
+        for (k = 0; k < m->nslot; k++)
+            cnt[c*newsz + k] = m->cnt[c*oldsz + k];
+        if (!m->ghash) {
+            for (k = 0; k < TRI(m->nslot,0); k++)
+                cnt[c*newsz + nslot + k] = m->cnt[c*oldsz + m->nslot + k];
+        }
+    }
+
+    if (m->cnt) free(m->cnt);
+    m->cnt = cnt;
+    m->nslot = nslot;
+    m->ncell = ncell;
+}
+
+void
+count_allele (struct Marker *m, int cell, int a, int n)
+{
+    if (m->ghash)
+        m->cnt[cell*m->nslot + a] += n;
+    else
+        m->cnt[cell*(m->nslot + TRI(m->nslot,0)) + a] += n;
+}
+
+void
+count_genotype (struct Marker *m, int cell, int a, int b, int n)
+{
+    if (m->ghash)
+        *ghash_slot(m->ghash, (long) cell << 32 | TRI(a,b), 1) += n;
+    else
+        m->cnt[cell*(m->nslot + TRI(m->nslot,0)) + m->nslot + TRI(a,b)] += n;
+}
+
+int
+acount (struct Marker *m, int cell, int a)
+{
+    if (cell >= m->ncell)
+        return 0;
+    if (m->ghash)
+        return m->cnt[cell*m->nslot + a];
+    return m->cnt[cell*(m->nslot + TRI(m->nslot,0)) + a];
+}
+
+/*
+ *  Returns the count of the unordered genotype a/b.
+ */
+
+int
+gcount (struct Marker *m, int cell, int a, int b)
+{
+    int *p;
+
+    if (cell >= m->ncell)
+        return 0;
+    if (m->ghash) {
+        p = ghash_slot(m->ghash, (long) cell << 32 | TRI(a,b), 0);
+        return p ? *p : 0;
+    }
+    return m->cnt[cell*(m->nslot + TRI(m->nslot,0)) + m->nslot + TRI(a,b)];
+}
+
+/*
+ *  Find the count for a key in a genotype hash table. If the key is not
+ *  present, a zero count is added when add is set, otherwise the return
+ *  value is NULL.
+ */
+
+int *
+ghash_slot (struct GHash *g, long key, int add)
+{
+    int i, h, oldsize;
+    long *oldkey;
+    int *oldcnt;
+
+    if (g->size) {
+        h = (int) ((unsigned long) (key*0x9e3779b97f4a7c15UL) >> 32)
+                & (g->size - 1);
+        while (g->key[h] != -1) {
+            if (g->key[h] == key)
+                return &g->cnt[h];
+            h = (h + 1) & (g->size - 1);
+        }
+    }
+    if (!add)
+        return 0;
+
+    /* keep the table at most half full */
+    if (2*(g->nused + 1) > g->size) {
+        oldsize = g->size;
+        oldkey = g->key;
+        oldcnt = g->cnt;
+        g->size = oldsize ? 2*oldsize : 64;
+        g->key = (long *) allocMem(g->size*sizeof(long));
+        g->cnt = (int *) allocMem(g->size*sizeof(int));
+        for (i = 0; i < g->size; i++)
+            g->key[i] = -1;
+        g->nused = 0;
+        for (i = 0; i < oldsize; i++) {
+            if (oldkey[i] != -1)
+                *ghash_slot(g, oldkey[i], 1) = oldcnt[i];
+        }
+        if (oldsize) {
+            free(oldkey);
+            free(oldcnt);
+        }
+    }
+
+    h = (int) ((unsigned long) (key*0x9e3779b97f4a7c15UL) >> 32)
+            & (g->size - 1);
+    while (g->key[h] != -1)
+        h = (h + 1) & (g->size - 1);
+    g->key[h] = key;
+    g->cnt[h] = 0;
+    g->nused++;
+
+    return &g->cnt[h];
+}
+
+/*
+ *  A shard file holds the raw allele and genotype counts, by cell, for
+ *  a set of individuals. The file begins with a header, the axes, the
+ *  levels of each axis (one line per axis), and the cells, one line per
+ *  cell giving its level on each axis:
+ *
+ *      count-shard 2
+ *      axes <axis spec>
+ *      levels <# levels> <level> ...
+ *      cells <# cells>
+ *      <level> <level> ...
+ *
+ *  Then, for each marker, a line giving the marker name and alleles,
+ *  followed by one line for each non-zero allele count and one for each
+ *  non-zero genotype count:
+ *
+ *      marker <name> <# alleles> <allele> ...
+ *      a <cell> <allele> <count>
+ *      g <cell> <allele> <allele> <count>
+ *
+ *  where levels, cells and alleles are indices into the lists above,
+ *  counting from 0.
+ */
+
+void
+write_shard (char *shard)
+{
+    int i, j, c, a, b, n;
+    struct Marker *m;
+    FILE *fp;
+
+    fp = fopen(shard, "w");
+    if (!fp) {
+        fprintf(stderr, "cannot open %s\n", shard);
+        exit(1);
+    }
+
+    fprintf(fp, "count-shard 2\n");
+    fprintf(fp, "axes %s\n", axspec);
+    for (i = 0; i < naxis; i++) {
+        fprintf(fp, "levels %d", strata.nlev[i]);
+        for (j = 0; j < strata.nlev[i]; j++)
+            fprintf(fp, " %s", strata.lev[i][j]);
+        fprintf(fp, "\n");
+    }
+    fprintf(fp, "cells %d\n", strata.ncell);
+    for (c = 0; c < strata.ncell; c++) {
+        for (i = 0; i < naxis; i++)
+            fprintf(fp, i ? " %d" : "%d", strata.cellv[c*naxis + i]);
+        fprintf(fp, "\n");
+    }
+
+    for (i = 0; i < nmrk; i++) {
+        m = &mrk[i];
+        fprintf(fp, "marker %s %d", m->name, m->nall);
+        for (a = 0; a < m->nall; a++)
+            fprintf(fp, " %s", m->alleles[a]);
+        fprintf(fp, "\n");
+
+        for (c = 0; c < m->ncell; c++) {
+            for (a = 0; a < m->nall; a++) {
+                if ((n = acount(m, c, a)))
+                    fprintf(fp, "a %d %d %d\n", c, a, n);
             }
-            else
-                fprintf(fp, "%s %c %s %s %s %d %7.5f\n", m->name, affect,
-                        popid, m->alleles[kk], m->alleles[kk], tsum,
-                        1. - asum);
+            for (a = 0; a < m->nall; a++) {
+                for (b = 0; b <= a; b++) {
+                    if ((n = gcount(m, c, a, b)))
+                        fprintf(fp, "g %d %d %d %d\n", c, a, b, n);
+                }
+            }
+        }
+    }
+
+    if (fclose(fp)) {
+        fprintf(stderr, "error writing %s\n", shard);
+        exit(1);
+    }
+}
+
+/*
+ *  Read a shard file into a chunk. The first shard read defines the
+ *  axes and the set of markers; every later shard must have the same
+ *  axes, and the same markers in the same order.
+ */
+
+void
+read_shard (char *shard, struct Chunk *ck)
+{
+    int i, j, k, line, recsz, n, a, b, c, nall, ncell;
+    int nlev[MXAXIS], *lmap[MXAXIS], *cmap, v[MXAXIS];
+    char *rec, *recp, *save, *name;
+    char type[10];
+    struct Marker *m;
+    FILE *fp;
+
+    fp = fopen(shard, "r");
+    if (!fp) {
+        fprintf(stderr, "cannot open shard file %s\n", shard);
+        exit(1);
+    }
+
+    recsz = 0;
+    line = 1;
+    if (!read_record(fp, &rec, &recsz) || strcmp(rec, "count-shard 2\n")) {
+        fprintf(stderr, "%s: not a count shard file\n", shard);
+        exit(1);
+    }
+
+    line++;
+    if (!read_record(fp, &rec, &recsz)
+            || !(recp = strtok_r(rec, " \t\n", &save)) || strcmp(recp, "axes")
+            || !(recp = strtok_r(NULL, " \t\n", &save)))
+        goto bad;
+    if (nmrk == -1) {
+        axspec = (char *) allocMem(strlen(recp)+1);
+        strcpy(axspec, recp);
+        parse_axes(axspec);
+        init_strata(&strata);
+    }
+    else if (strcmp(recp, axspec)) {
+        fprintf(stderr, "%s: axes %s do not match the first shard\n", shard,
+                recp);
+        exit(1);
+    }
+
+    /* map the shard's levels and cells to the chunk's */
+    init_strata(&ck->st);
+    for (i = 0; i < naxis; i++) {
+        line++;
+        if (!read_record(fp, &rec, &recsz)
+                || !(recp = strtok_r(rec, " \t\n", &save))
+                || strcmp(recp, "levels")
+                || !(recp = strtok_r(NULL, " \t\n", &save))
+                || sscanf(recp, "%d", &n) != 1 || n < 0)
+            goto bad;
+        nlev[i] = n;
+        lmap[i] = (int *) allocMem((n + 1)*sizeof(int));
+        for (j = 0; j < n; j++) {
+            if (!(recp = strtok_r(NULL, " \t\n", &save)))
+                goto bad;
+            lmap[i][j] = find_level(&ck->st, i, recp);
+        }
+    }
+
+    line++;
+    if (!read_record(fp, &rec, &recsz) || sscanf(rec, "cells %d", &ncell) != 1
+            || ncell < 0)
+        goto bad;
+    cmap = (int *) allocMem((ncell + 1)*sizeof(int));
+    for (c = 0; c < ncell; c++) {
+        line++;
+        if (!read_record(fp, &rec, &recsz))
+            goto bad;
+        recp = strtok_r(rec, " \t\n", &save);
+        for (i = 0; i < naxis; i++) {
+            if (!recp || sscanf(recp, "%d", &k) != 1 || k < 0
+                    || k >= nlev[i])
+                goto bad;
+            v[i] = lmap[i][k];
+            recp = strtok_r(NULL, " \t\n", &save);
+        }
+        cmap[c] = find_cell(&ck->st, v);
+    }
+
+    ck->mrk = 0;
+    ck->shared = 0;
+    i = -1;
+    m = 0;
+    while (line++, read_record(fp, &rec, &recsz)) {
+        if (!(recp = strtok_r(rec, " \t\n", &save)))
+            goto bad;
+
+        if (!strcmp(recp, "marker")) {
+            if (!(recp = strtok_r(NULL, " \t\n", &save)))
+                goto bad;
+            i++;
+            if (nmrk == -1 || (i < nmrk && !strcmp(recp, mrk[i].name))) {
+                ck->mrk = (struct Marker *) growMem(ck->mrk,
+                                                (i+1)*sizeof(struct Marker));
+                m = &ck->mrk[i];
+                m->name = (char *) allocMem(strlen(recp)+1);
+                strcpy(m->name, recp);
+            }
+            else {
+                fprintf(stderr,
+                    "%s: marker %s does not match the first shard, line %d\n",
+                        shard, recp, line);
+                exit(1);
+            }
+            m->nall = 0;
+            m->nslot = 0;
+            m->ncell = 0;
+            m->cnt = 0;
+            m->ghash = 0;
+            m->nqc = 0;
+            m->qc = 0;
+
+            if (!(recp = strtok_r(NULL, " \t\n", &save))
+                    || sscanf(recp, "%d", &nall) != 1 || nall < 0)
+                goto bad;
+            while (m->nall < nall) {
+                if (!(recp = strtok_r(NULL, " \t\n", &save)))
+                    goto bad;
+                name = (char *) allocMem(strlen(recp)+1);
+                strcpy(name, recp);
+                add_allele(name, &m->alleles, &m->nall);
+            }
+            continue;
+        }
+
+        if (!m || strlen(recp) != 1 || (*recp != 'a' && *recp != 'g'))
+            goto bad;
+        strcpy(type, recp);
+        if (!(recp = strtok_r(NULL, "\n", &save)))
+            goto bad;
+        if (*type == 'a') {
+            if (sscanf(recp, "%d %d %d", &c, &a, &n) != 3)
+                goto bad;
+            b = 0;
+        }
+        else if (sscanf(recp, "%d %d %d %d", &c, &a, &b, &n) != 4)
+            goto bad;
+        if (c < 0 || c >= ncell || a < 0 || a >= m->nall || b < 0
+                || b >= m->nall || n < 0)
+            goto bad;
+
+        c = cmap[c];
+        if (m->nall > m->nslot || c >= m->ncell)
+            grow_counts(m, m->nall, c + 1);
+        if (*type == 'a')
+            count_allele(m, c, a, n);
+        else
+            count_genotype(m, c, a, b, n);
+    }
+
+    if (nmrk == -1) {
+        nmrk = i + 1;
+        mrk = (struct Marker *) allocMem((nmrk+1)*sizeof(struct Marker));
+        for (i = 0; i < nmrk; i++) {
+            mrk[i].name = ck->mrk[i].name;
+            mrk[i].nall = 0;
+            mrk[i].nslot = 0;
+            mrk[i].ncell = 0;
+            mrk[i].cnt = 0;
+            mrk[i].ghash = 0;
+            mrk[i].nqc = 0;
+            mrk[i].qc = 0;
+        }
+    }
+    else if (i + 1 != nmrk) {
+        fprintf(stderr, "%s: markers do not match the first shard\n", shard);
+        exit(1);
+    }
+    else {
+        for (i = 0; i < nmrk; i++)
+            free(ck->mrk[i].name);
+    }
+
+    for (i = 0; i < naxis; i++)
+        free(lmap[i]);
+    free(cmap);
+    fclose(fp);
+    if (recsz) free(rec);
+    return;
+
+bad:
+    fprintf(stderr, "%s: invalid shard file, line %d\n", shard, line);
+    exit(1);
+}
+
+/*
+ *  Write the counts to a binary count store, laid out as described in
+ *  cntstore.h. The strata are the same ones written to the frequency
+ *  files, and alleles are in the same (sorted) order.
+ */
+
+void
+write_store (char *file)
+{
+    int i, k, l, c, s, nall, ncnt, nstrata, npop, pop, aff;
+    int sidx[4];
+    char **pops;
+    int32_t *cnt, *cp, *ndx;
+    int64_t off, *soff, *aoff, strsz, strused;
+    char *strtab;
+    struct CsHeader hdr;
+    struct CsMarker *cm;
+    struct Marker *m;
+    FILE *fp;
+
+    fp = fopen(file, "w");
+    if (!fp) {
+        fprintf(stderr, "cannot open %s\n", file);
+        exit(1);
+    }
+
+    /* the store holds the default strata, aff,pop */
+    npop = strata.nlev[1];
+    pops = strata.lev[1];
+    nstrata = CS_NSTRATA(npop);
+    strtab = 0;
+    strsz = 0;
+    strused = 0;
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, CS_MAGIC, sizeof(hdr.magic));
+    hdr.nmrk = nmrk;
+    hdr.npop = npop;
+    hdr.popoff = CS_ALIGN(sizeof(hdr));
+    hdr.mrkoff = CS_ALIGN(hdr.popoff + 8*(int64_t) npop);
+    hdr.ndxoff = CS_ALIGN(hdr.mrkoff + sizeof(struct CsMarker)*(int64_t) nmrk);
+
+    soff = (int64_t *) allocMem((npop + 1)*sizeof(int64_t));
+    for (i = 0; i < npop; i++)
+        soff[i] = store_string(pops[i], &strtab, &strsz, &strused);
+
+    cm = (struct CsMarker *) allocMem((nmrk + 1)*sizeof(struct CsMarker));
+    off = CS_ALIGN(hdr.ndxoff + 4*(int64_t) nmrk);
+    for (i = 0; i < nmrk; i++) {
+        cm[i].name = store_string(mrk[i].name, &strtab, &strsz, &strused);
+        cm[i].block = off;
+        cm[i].nall = mrk[i].nall;
+        cm[i].pad = 0;
+        off += CS_BLOCKSIZE(mrk[i].nall, npop);
+    }
+    hdr.stroff = off;
+
+    ndx = (int32_t *) allocMem((nmrk + 1)*sizeof(int32_t));
+    for (i = 0; i < nmrk; i++)
+        ndx[i] = i;
+    qsort(ndx, nmrk, sizeof(int32_t), cmp_mrkname);
+
+    fwrite(&hdr, sizeof(hdr), 1, fp);
+    fseeko(fp, hdr.popoff, SEEK_SET);
+    fwrite(soff, sizeof(int64_t), npop, fp);
+    fseeko(fp, hdr.mrkoff, SEEK_SET);
+    fwrite(cm, sizeof(struct CsMarker), nmrk, fp);
+    fseeko(fp, hdr.ndxoff, SEEK_SET);
+    fwrite(ndx, sizeof(int32_t), nmrk, fp);
+
+    for (i = 0; i < nmrk; i++) {
+        m = &mrk[i];
+        nall = m->nall;
+        ncnt = CS_NCNT(nall);
+
+        aoff = (int64_t *) allocMem((nall + 1)*sizeof(int64_t));
+        for (k = 0; k < nall; k++)
+            aoff[k] = store_string(m->alleles[m->all_sort[k]], &strtab,
+                                   &strsz, &strused);
+
+        /* add the counts in each cell into the strata containing it */
+        cnt = (int32_t *) allocMem((nstrata*ncnt + 1)*sizeof(int32_t));
+        for (k = 0; k < nstrata*ncnt; k++)
+            cnt[k] = 0;
+        for (c = 0; c < m->ncell; c++) {
+            aff = strata.cellv[c*2] + 1;
+            pop = strata.cellv[c*2 + 1];
+            sidx[0] = CS_STRATUM(npop, aff, pop);
+            sidx[1] = CS_STRATUM(npop, aff, -1);
+            sidx[2] = CS_STRATUM(npop, 0, pop);
+            sidx[3] = CS_STRATUM(npop, 0, -1);
+            for (s = 0; s < 4; s++) {
+                cp = cnt + sidx[s]*ncnt;
+                for (k = 0; k < nall; k++) {
+                    cp[k] += acount(m, c, m->all_sort[k]);
+                    for (l = 0; l <= k; l++)
+                        cp[nall + TRI(k,l)] +=
+                            gcount(m, c, m->all_sort[k], m->all_sort[l]);
+                }
+            }
+        }
+
+        fseeko(fp, cm[i].block, SEEK_SET);
+        fwrite(aoff, sizeof(int64_t), nall, fp);
+        fwrite(cnt, sizeof(int32_t), nstrata*ncnt, fp);
+        free(aoff);
+        free(cnt);
+    }
+
+    fseeko(fp, hdr.stroff, SEEK_SET);
+    fwrite(strtab, 1, strused, fp);
+
+    if (fclose(fp)) {
+        fprintf(stderr, "error writing %s\n", file);
+        exit(1);
+    }
+
+    free(soff);
+    free(cm);
+    free(ndx);
+    free(strtab);
+}
+
+/*
+ *  Append a string to the store's string table, returning its offset.
+ */
+
+int64_t
+store_string (char *str, char **tab, int64_t *size, int64_t *used)
+{
+    int64_t off;
+    int len = strlen(str) + 1;
+
+    if (*used + len > *size) {
+        *size = *size ? 2*(*size) : 10000;
+        if (*size < *used + len)
+            *size = *used + len;
+        *tab = (char *) growMem(*tab, *size);
+    }
+    memcpy(*tab + *used, str, len);
+    off = *used;
+    *used += len;
+
+    return off;
+}
+
+int
+cmp_mrkname (const void *a, const void *b)
+{
+    return strcmp(mrk[*(int32_t *) a].name, mrk[*(int32_t *) b].name);
+}
+
+/*
+ *  Read one line of arbitrary length into a buffer which is grown as
+ *  needed. Returns the length of the line, or 0 at end of file.
+ */
+
+int
+read_record (FILE *fp, char **buf, int *size)
+{
+    int len;
+
+    if (!*size) {
+        *size = 10000;
+        *buf = (char *) allocMem(*size);
+    }
+
+    len = 0;
+    while (fgets(*buf + len, *size - len, fp)) {
+        len += strlen(*buf + len);
+        if ((*buf)[len-1] == '\n')
+            break;
+        if (len == *size - 1) {
+            *size *= 2;
+            *buf = (char *) growMem(*buf, *size);
         }
     }
+
+    return len;
 }
 
 int
@@ -708,6 +2230,50 @@ add_name (char *str, char ***array, int *nelem)
     return *nelem - 1;
 }
 
+/*
+ *  Like add_name, for the allele names of a marker, but the name itself
+ *  is stored, not a copy. Most markers have few alleles, so the array
+ *  starts with room for 2 names and is doubled as needed, rather than
+ *  grown ALLBLK at a time.
+ */
+
+int
+add_allele (char *str, char ***array, int *nelem)
+{
+    if (!*nelem)
+        *array = (char **) allocMem(2*sizeof(char *));
+    else if (*nelem >= 2 && !(*nelem & (*nelem - 1)))
+        *array = (char **) growMem(*array, 2*(*nelem)*sizeof(char *));
+
+    (*array)[*nelem] = str;
+    (*nelem)++;
+
+    return *nelem - 1;
+}
+
+/*
+ *  The shared copy of allele name str of marker i, added to dict if it
+ *  is not there yet. Called by the threads reading the pedigree file.
+ */
+
+char *
+intern_allele (int i, char *str)
+{
+    int j;
+    char *name;
+
+    pthread_mutex_lock(&dict_lock);
+    if ((j = get_ndx(str, dict[i].alleles, dict[i].nall)) == -1) {
+        name = (char *) allocMem(strlen(str)+1);
+        strcpy(name, str);
+        j = add_allele(name, &dict[i].alleles, &dict[i].nall);
+    }
+    name = dict[i].alleles[j];
+    pthread_mutex_unlock(&dict_lock);
+
+    return name;
+}
+
 void
 sort_names (char **array, int nelem, int *order)
 {
@@ -746,3 +2312,14 @@ void
     }
     return ptr;
 }
+
+void
+*growMem (void *ptr, size_t nbytes)
+{
+    ptr = (void *) realloc(ptr, nbytes);
+    if (!ptr) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+    return ptr;
+}
@@ -0,0 +1,207 @@
+/*
+ * genomat.c
+ *
+ *
+ * Storage for the genotype matrix described in genomat.h.
+ *
+ *     gm_alloc(g, nmrk, nind)   allocate the matrix, all alleles untyped
+ *     gm_free(g)                free the matrix
+ *     gm_spill(g, nmrk, nind, limit)
+ *                               set up a matrix spilled to a temporary
+ *                               file, staging batches of individuals in
+ *                               at most about limit bytes
+ *     gm_stage(g, i)            make individual i part of the staged
+ *                               batch, writing out the batch first if
+ *                               it is full
+ *     gm_spill_done(g, nslot)   write out the last batch, and make room
+ *                               for nslot markers to be loaded
+ *     gm_load(g, n, mrks)       load the n markers listed from the spill
+ *                               file, dropping those loaded before
+ *
+ * The spill file is read and written with pread and pwrite, at the
+ * offsets of the rows, so it may be larger than memory. A marker listed
+ * twice to gm_load is loaded once.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "genomat.h"
+
+static uint8_t *
+alloc_rows (size_t size)
+{
+    void *ptr;
+
+    if (posix_memalign(&ptr, 64, size ? size : 64)) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+    memset(ptr, GM_MISSING, size);
+
+    return (uint8_t *) ptr;
+}
+
+void
+gm_alloc (struct GenoMat *g, int nmrk, int nind)
+{
+    g->nmrk = nmrk;
+    g->nind = nind;
+    g->stride = ((size_t) nind + 63) & ~(size_t) 63;
+    g->all = alloc_rows(2*(size_t) nmrk*g->stride);
+    g->row = 0;
+    g->slot = 0;
+    g->nslot = 0;
+    g->i0 = 0;
+    g->nstage = 0;
+    g->spill = 0;
+}
+
+void
+gm_free (struct GenoMat *g)
+{
+    free(g->all);
+    g->all = 0;
+    free(g->row);
+    g->row = 0;
+    free(g->slot);
+    g->slot = 0;
+    if (g->spill)
+        fclose(g->spill);
+    g->spill = 0;
+}
+
+/*
+ *  The batch is as many individuals, in multiples of 64, as fit in limit
+ *  bytes, but at least 64 and at most all of them. The spill file is
+ *  made its full size at once, so that every row can be read whole.
+ */
+
+void
+gm_spill (struct GenoMat *g, int nmrk, int nind, size_t limit)
+{
+    size_t n;
+
+    g->nmrk = nmrk;
+    g->nind = nind;
+    n = (limit/(2*(size_t) (nmrk ? nmrk : 1))) & ~(size_t) 63;
+    if (n < 64)
+        n = 64;
+    if (n > (((size_t) nind + 63) & ~(size_t) 63))
+        n = ((size_t) nind + 63) & ~(size_t) 63;
+    g->nstage = n;
+    g->stride = n;
+    g->all = alloc_rows(2*(size_t) nmrk*g->stride);
+    g->row = 0;
+    g->slot = 0;
+    g->nslot = 0;
+    g->i0 = 0;
+
+    if (!(g->spill = tmpfile())) {
+        fprintf(stderr, "cannot create temporary file\n");
+        exit(1);
+    }
+    n = ((size_t) nind + 63) & ~(size_t) 63;
+    if (ftruncate(fileno(g->spill), (off_t) (2*(size_t) nmrk*n))) {
+        fprintf(stderr, "error writing temporary file\n");
+        exit(1);
+    }
+}
+
+/*
+ *  Write the rows of the staged batch, of individuals i0..i-1, into
+ *  their columns of the spill file, whose rows are nind bytes rounded
+ *  up to a multiple of 64.
+ */
+
+static void
+write_batch (struct GenoMat *g, int i)
+{
+    int r;
+    size_t n = i - g->i0;
+    size_t fstride = ((size_t) g->nind + 63) & ~(size_t) 63;
+    int fd = fileno(g->spill);
+
+    for (r = 0; r < 2*g->nmrk; r++) {
+        if (pwrite(fd, g->all + r*g->stride, n,
+                   (off_t) (r*fstride + g->i0)) != (ssize_t) n) {
+            fprintf(stderr, "error writing temporary file\n");
+            exit(1);
+        }
+    }
+}
+
+void
+gm_stage (struct GenoMat *g, int i)
+{
+    if (i - g->i0 < g->nstage)
+        return;
+
+    write_batch(g, i);
+    memset(g->all, GM_MISSING, 2*(size_t) g->nmrk*g->stride);
+    g->i0 = i;
+}
+
+void
+gm_spill_done (struct GenoMat *g, int nslot)
+{
+    int m;
+
+    write_batch(g, g->nind);
+    free(g->all);
+
+    g->i0 = 0;
+    g->stride = ((size_t) g->nind + 63) & ~(size_t) 63;
+    g->nslot = nslot;
+    g->all = alloc_rows(2*(size_t) nslot*g->stride);
+    g->row = (int *) malloc((g->nmrk + 1)*sizeof(int));
+    g->slot = (int *) malloc((nslot + 1)*sizeof(int));
+    if (!g->row || !g->slot) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+    for (m = 0; m < g->nmrk; m++)
+        g->row[m] = -1;
+    for (m = 0; m < nslot; m++)
+        g->slot[m] = -1;
+}
+
+/*
+ *  The two rows of a marker are adjacent, in the file as in memory, so
+ *  each marker is one read.
+ */
+
+void
+gm_load (struct GenoMat *g, int n, int *mrks)
+{
+    int k, m, s;
+    size_t size = 2*g->stride;
+    int fd = fileno(g->spill);
+
+    for (s = 0; s < g->nslot; s++) {
+        if (g->slot[s] != -1)
+            g->row[g->slot[s]] = -1;
+        g->slot[s] = -1;
+    }
+
+    s = 0;
+    for (k = 0; k < n; k++) {
+        m = mrks[k];
+        if (g->row[m] != -1)
+            continue;
+        if (s == g->nslot) {
+            fprintf(stderr, "gm_load: more than %d markers\n", g->nslot);
+            exit(1);
+        }
+        if (pread(fd, g->all + s*size, size, (off_t) (m*size)) !=
+                (ssize_t) size) {
+            fprintf(stderr, "error reading temporary file\n");
+            exit(1);
+        }
+        g->row[m] = s;
+        g->slot[s++] = m;
+    }
+}
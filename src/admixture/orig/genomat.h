@@ -0,0 +1,55 @@
+/*
+ * genomat.h
+ *
+ * Genotype matrix: the two allele codes of every individual at every
+ * marker. The matrix is stored marker-major, so that the alleles of
+ * all individuals at one marker lie in two contiguous rows, one for
+ * each allele of the genotype:
+ *
+ *     row 2*m      first alleles at marker m, individuals 0..nind-1
+ *     row 2*m+1    second alleles at marker m
+ *
+ * An allele is coded by its index in the marker's allele list, and an
+ * untyped allele by GM_MISSING. Each row begins on a 64-byte boundary.
+ *
+ * A matrix too large for memory may be spilled to a temporary file,
+ * laid out just as the matrix in memory. The genotypes are then read in
+ * batches of individuals: while a batch is staged, GM_ALL1 and GM_ALL2
+ * give the rows of the batch, indexed by individual as usual, and each
+ * full batch is written into the columns of its individuals in the
+ * file. Once all are read, only the markers last loaded are held, each
+ * in a slot of memory, and row[m] is the slot of marker m, or -1.
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define GM_MISSING	0xFF	/* code of an untyped allele		*/
+#define GM_MXALL	255	/* max # alleles per marker		*/
+
+struct GenoMat {
+    int nmrk;			/* number of markers			*/
+    int nind;			/* number of individuals		*/
+    size_t stride;		/* bytes per row, a multiple of 64	*/
+    uint8_t *all;		/* allele codes				*/
+    int *row;			/* slot of each marker, or 0 if all held */
+    int nslot;			/* # markers held, if spilled		*/
+    int *slot;			/* marker in each slot, or -1		*/
+    int i0;			/* first individual of the staged batch	*/
+    int nstage;			/* # individuals per batch		*/
+    FILE *spill;		/* spill file, or 0			*/
+} ;
+
+#define GM_ROW(g, m)	((g)->row ? (g)->row[m] : (m))
+#define GM_ALL1(g, m)	\
+	((g)->all + (size_t) (2*GM_ROW(g, m))*(g)->stride - (g)->i0)
+#define GM_ALL2(g, m)	\
+	((g)->all + (size_t) (2*GM_ROW(g, m) + 1)*(g)->stride - (g)->i0)
+
+void gm_alloc (struct GenoMat *g, int nmrk, int nind);
+void gm_free (struct GenoMat *g);
+void gm_spill (struct GenoMat *g, int nmrk, int nind, size_t limit);
+void gm_stage (struct GenoMat *g, int i);
+void gm_spill_done (struct GenoMat *g, int nslot);
+void gm_load (struct GenoMat *g, int n, int *mrks);
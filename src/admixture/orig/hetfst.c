@@ -10,22 +10,65 @@
  * are computed for each population and for the total sample. F_st is
  * derived both analytically and by jackknifing, and is reported for
  * affected individuals, unaffected individuals, and the total sample.
- * Jackknifing also yields an estimate of the variance in F_st.
+ * Jackknifing also yields an estimate of the variance in F_st. Each
+ * jackknife sample's allele counts are found by removing one individual
+ * from the counts for the full sample, so the time taken grows only
+ * linearly with the number of individuals.
  *
  *
- * Usage:  hetfst [-M missval] pedfile genfrq hetout fstout
+ * Usage:  hetfst [-M missval] [-t nthreads] [-P pairout] [-k blksize]
+ *                [-L mbytes] pedfile genfrq hetout fstout
+ *         hetfst -G [-M missval] [-t nthreads] [-P pairout] [-k blksize]
+ *                [-L mbytes] pedfile locfile hetout fstout
  *
  *         pedfile      pedigree file (marker genotypes)
- *         genfrq       genotype frequencies file
+ *         genfrq       genotype frequencies file or binary count store
+ *         locfile      locus file (marker names), with -G
  *         hetout       heterozygosity output file
  *         fstout       F statistics output file
  *
  *         options:
  *           -M missval   missing allele value in quotes, e.g. "0"
+ *           -t nthreads  number of threads used for the F statistics
+ *           -P pairout   write pairwise population F_st to pairout
+ *           -k blksize   markers per jackknife block for -P (default 20)
+ *           -G           compute heterozygosity from the genotypes
+ *           -L mbytes    hold the genotypes in about mbytes MB of memory
  *
  *   The missing allele value is used in genotypes to denote an untyped
  *   allele. The default missing value is an asterisk (*).
  *
+ *   A binary count store, written by count -b, may be given in place
+ *   of the genotype frequencies file.
+ *
+ *   With the -t option, the F statistics for blocks of markers are
+ *   computed by nthreads threads in parallel. The output is the same
+ *   for any number of threads.
+ *
+ *   With the -P option, F_st is also estimated for each pair of
+ *   populations, over all markers at once, as the ratio of the sums
+ *   across markers of the numerator and denominator of F_st. Standard
+ *   errors come from a jackknife over blocks of blksize consecutive
+ *   markers, which allows for linkage between nearby markers. A pair with
+ *   no marker polymorphic in either population has no estimate.
+ *
+ *   With the -G option, no genotype frequencies are needed, so program
+ *   count need not be run first. The marker names are taken from a
+ *   locus file, as used by count, and the alleles and populations from
+ *   the pedigree file. Heterozygosity is then the fraction of fully
+ *   typed individuals who are heterozygous, computed exactly rather
+ *   than from rounded genotype frequencies, and the variance for each
+ *   population is based on the number of individuals in it.
+ *
+ *   With the -L option, the genotypes are held in about mbytes megabytes of
+ *   memory. The limit bounds only the genotypes; the allele frequencies and
+ *   the statistics of each marker are held for all markers, as without -L.
+ *   The pedigree file is read in batches of individuals, each written to its
+ *   columns of a temporary file laid out marker by marker, and the F
+ *   statistics are then computed for as many markers at a time as fit within
+ *   the limit, read back from that file. The output is the same as without
+ *   -L.
+ *
  *
  * File formats:
  *
@@ -69,6 +112,10 @@
  *   first for all individuals in the sample and then for unaffecteds
  *   and affecteds.
  *
+ *   The pairwise output file lists the genome-wide F_st and its
+ *   jackknife standard error for each pair of populations, followed by
+ *   the same estimates laid out as a matrix.
+ *
  *
  */
 
@@ -77,6 +124,10 @@
 #include <stdlib.h>
 #include <math.h>
 
+#include "cntstore.h"
+#include "genomat.h"
+#include "thrpool.h"
+
 #define MXPOP	3	/* max # populations		*/
 #define MXALL	40	/* max # alleles per marker	*/
 
@@ -84,6 +135,10 @@
 
 #define ALLBLK  256	/* # array elements malloc'd at a time		*/
 
+#define MRKBLK	64	/* # markers per task when threaded	*/
+
+#define JKBLK	20	/* default # markers per jackknife block	*/
+
 
 struct Marker {
     char *name;		/* marker name			*/
@@ -104,7 +159,23 @@ int ninda[2];		/* # individuals by affection status	*/
 
 int *pop;		/* population			*/
 int *aff;		/* affection status		*/
-int **all1, **all2;	/* alleles at each marker	*/
+struct GenoMat geno;	/* alleles at each marker	*/
+
+/*
+ *  Allele and homozygote counts at one marker, by population, for the
+ *  individuals in a sample. The F statistics depend on the genotypes
+ *  only through these counts, so the counts for a jackknife sample are
+ *  found by removing one individual's genotype from those for the full
+ *  sample, rather than by recounting.
+ */
+
+#define NSTRAT	3	/* strata: total sample, unaffecteds, affecteds */
+
+struct Counts {
+    int nidp[MXPOP];		/* # individuals by population	*/
+    int acnt[MXPOP][MXALL];	/* # copies of each allele	*/
+    int gcnt[MXPOP][MXALL];	/* # homozygotes for each allele */
+} ;
 
 
 /*
@@ -121,36 +192,101 @@ char **famids;		/* family IDs			*/
 int nid = 0;		/* number of individual IDs	*/
 char **ids;		/* individual IDs		*/
 
+int nthread = 1;	/* number of threads		*/
+int genos = 0;		/* heterozygosity from genotypes? */
+double memlimit = 0;	/* bytes for the genotypes with -L, or 0 */
+
+/*
+ *  The markers whose F statistics are computed while their genotypes
+ *  are held, and the output lines of every marker and stratum.
+ */
+
+struct FstJob {
+    int lo, hi;		/* block of markers, lo <= m < hi	*/
+    char **fline;	/* lines of marker m at m*NSTRAT	*/
+} ;
+
+/*
+ *  Pairwise F_st is estimated genome-wide as a ratio of sums over
+ *  markers, sum(hetT' - hetS')/sum(hetT'), where hetS' and hetT' are
+ *  computed as in calc_f but for the two populations only. The
+ *  numerator and denominator terms are kept for each marker and pair.
+ */
+
+int npair;		/* number of population pairs	*/
+double *pnum;		/* numerator terms, by marker and pair	*/
+double *pden;		/* denominator terms, by marker and pair */
+
 
 void show_usage (char *);
 void read_genfreq_file (char *);
+void read_store (char *);
+void read_locus_file (char *);
+void alloc_het (void);
 void read_pedigree_file (char *, char *);
-int calc_f (int, int, int, double *, double *, double *);
+void fst_task (int, void *);
+void do_fstats (int, double *, char **);
+void tally_counts (int, struct Counts *);
+void pair_terms (int, struct Counts *);
+void write_pairs (char *, int);
+void add_ind (int, int, int, struct Counts *);
+int calc_f (int, struct Counts *, double *, double *, double *);
 int get_ndx (char *, char **, int);
 int add_name (char *, char ***, int *);
+int read_record (FILE *, char **, int *);
 void *allocMem (size_t);
+void *growMem (void *, size_t);
+
+#define min(a,b)	((a) <= (b) ? (a) : (b))
 
 
 main (int argc, char **argv)
 {
-    int i, j, err;
-    double fis, ujfis, *jfis, jfisvar;
-    double fit, ujfit, *jfit, jfitvar;
-    double fst, ujfst, *jfst, jfstvar;
+    int i, j, s, nload, *mrks;
+    struct FstJob job;
+    char **fline;
     FILE *fpf, *fph;
 
-    int errflg = 0;
+    int errflg = 0, jkblk = JKBLK;
+    char *pairout = 0;
     char missval[10] = "";
     extern char *optarg;
     extern int optind, optopt;
 
     /* gather command line arguments */
-    while ((i = getopt(argc, argv, ":M:")) != -1) {
+    while ((i = getopt(argc, argv, ":M:t:P:k:GL:")) != -1) {
         switch (i) {
         case 'M':
             strncpy(missval, optarg, sizeof(missval)-1);
             missval[sizeof(missval)-1] = 0;
             break;
+        case 't':
+            nthread = atoi(optarg);
+            if (nthread < 1) {
+                fprintf(stderr, "-t: number of threads must be positive\n");
+                exit(1);
+            }
+            break;
+        case 'P':
+            pairout = optarg;
+            break;
+        case 'G':
+            genos = 1;
+            break;
+        case 'k':
+            jkblk = atoi(optarg);
+            if (jkblk < 1) {
+                fprintf(stderr, "-k: block size must be positive\n");
+                exit(1);
+            }
+            break;
+        case 'L':
+            memlimit = atof(optarg)*1024*1024;
+            if (memlimit <= 0) {
+                fprintf(stderr, "-L: memory limit must be positive\n");
+                exit(1);
+            }
+            break;
         case ':':
             fprintf(stderr, "option -%c requires an operand\n", optopt);
             errflg++;
@@ -171,153 +307,71 @@ main (int argc, char **argv)
         missval[sizeof(missval)-1] = 0;
     }
 
-    read_genfreq_file(argv[optind+1]);
+    if (genos)
+        read_locus_file(argv[optind+1]);
+    else if (cs_is_store(argv[optind+1]))
+        read_store(argv[optind+1]);
+    else
+        read_genfreq_file(argv[optind+1]);
 
     read_pedigree_file(argv[optind], missval);
 
-    jfis = (double *) allocMem(nindt*sizeof(double));
-    jfit = (double *) allocMem(nindt*sizeof(double));
-    jfst = (double *) allocMem(nindt*sizeof(double));
-
-    /* compute standard and jackknifed F statistics for total sample */
-    fpf = fopen(argv[optind+3], "w");
-    fprintf(fpf, "TOTAL SAMPLE (N = %d)\n", nindt);
-    fprintf(fpf,
-    "MARKER   FIS     FIT     FST     J_FIS   J_SE    J_FIT   J_SE    J_FST   J_SE\n");
+    if (pairout) {
+        npair = npop*(npop - 1)/2;
+        pnum = (double *) allocMem((nmrk*npair + 1)*sizeof(double));
+        pden = (double *) allocMem((nmrk*npair + 1)*sizeof(double));
+    }
 
-    for (j = 0; j < nmrk; j++) {
-        calc_f(j, -1, 0, &ujfis, &ujfit, &ujfst);	/* standard F stats */
-        fis = 0;
-        fit = 0;
-        fst = 0;
-        for (i = 0; i < nindt; i++) {
-            /* jackknifed F stats */
-            err = calc_f(j, i, 0, &jfis[i], &jfit[i], &jfst[i]);
-            if (err) break;
-            fis += jfis[i];
-            fit += jfit[i];
-            fst += jfst[i];
-        }
-        if (err) {
-            fprintf(fpf,
-                    "%-8s %7.4f %7.4f %7.4f Sample too small for jackknifing.\n",
-                    mrk[j].name, ujfis, ujfit, ujfst);
-        }
-        else {
-            jfisvar = 0;
-            jfitvar = 0;
-            jfstvar = 0;
-            for (i = 0; i < nindt; i++) {
-                jfisvar += pow(jfis[i] - fis/nindt, 2.);
-                jfitvar += pow(jfit[i] - fit/nindt, 2.);
-                jfstvar += pow(jfst[i] - fst/nindt, 2.);
-            }
-            fprintf(fpf,
-                    "%-8s %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f\n",
-                    mrk[j].name, ujfis, ujfit, ujfst,
-                    nindt*ujfis - (nindt-1)*fis/nindt, sqrt((nindt-1)*jfisvar/nindt),
-                    nindt*ujfit - (nindt-1)*fit/nindt, sqrt((nindt-1)*jfitvar/nindt),
-                    nindt*ujfst - (nindt-1)*fst/nindt, sqrt((nindt-1)*jfstvar/nindt));
+    /* with -L, the markers are loaded from the spill file as many at a
+       time as fit within the limit */
+    nload = nmrk;
+    mrks = 0;
+    if (memlimit) {
+        nload = min(nmrk, memlimit/(2*(((size_t) nindt + 63) & ~(size_t) 63)));
+        if (nload < 1) {
+            fprintf(stderr, "-L: memory limit too small for one marker\n");
+            exit(1);
         }
+        gm_spill_done(&geno, nload);
+        mrks = (int *) allocMem(nload*sizeof(int));
     }
 
-    /* compute standard and jackknifed F statistics for unaffecteds */
-    fprintf(fpf, "\nUNAFFECTED (N = %d)\n", ninda[0]);
-    fprintf(fpf,
-    "MARKER   FIS     FIT     FST     J_FIS   J_SE    J_FIT   J_SE    J_FST   J_SE\n");
-
-    for (j = 0; j < nmrk; j++) {
-        calc_f(j, -1, 1, &ujfis, &ujfit, &ujfst);	/* standard F stats */
-        fis = 0;
-        fit = 0;
-        fst = 0;
-        for (i = 0; i < nindt; i++) {
-            /* jackknifed F stats */
-            if (aff[i] == 1) {
-                err = calc_f(j, i, 1, &jfis[i], &jfit[i], &jfst[i]);
-                if (err) break;
-                fis += jfis[i];
-                fit += jfit[i];
-                fst += jfst[i];
-            }
-        }
-        if (err) {
-            fprintf(fpf, "%-8s %7.4f %7.4f %7.4f Sample too small for jackknifing.\n",
-                    mrk[j].name, ujfis, ujfit, ujfst);
-        }
-        else {
-            jfisvar = 0;
-            jfitvar = 0;
-            jfstvar = 0;
-            for (i = 0; i < nindt; i++) {
-                if (aff[i] == 1) {
-                    jfisvar += pow(jfis[i] - fis/ninda[0], 2.);
-                    jfitvar += pow(jfit[i] - fit/ninda[0], 2.);
-                    jfstvar += pow(jfst[i] - fst/ninda[0], 2.);
-                }
-            }
-            fprintf(fpf,
-                    "%-8s %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f\n",
-                    mrk[j].name, ujfis, ujfit, ujfst,
-                    ninda[0]*ujfis - (ninda[0]-1)*fis/ninda[0],
-                    sqrt((ninda[0]-1)*jfisvar/ninda[0]),
-                    ninda[0]*ujfit - (ninda[0]-1)*fit/ninda[0],
-                    sqrt((ninda[0]-1)*jfitvar/ninda[0]),
-                    ninda[0]*ujfst - (ninda[0]-1)*fst/ninda[0],
-                    sqrt((ninda[0]-1)*jfstvar/ninda[0]));
+    /* compute standard and jackknifed F statistics for every stratum,
+       in blocks of markers which may be run in parallel */
+    fline = (char **) allocMem((nmrk*NSTRAT + 1)*sizeof(char *));
+    job.fline = fline;
+    for (job.lo = 0; job.lo < nmrk; job.lo += nload) {
+        job.hi = min(job.lo + nload, nmrk);
+        if (memlimit) {
+            for (j = job.lo; j < job.hi; j++)
+                mrks[j - job.lo] = j;
+            gm_load(&geno, job.hi - job.lo, mrks);
         }
+        run_tasks(nthread, (job.hi - job.lo + MRKBLK - 1)/MRKBLK, fst_task,
+                  &job);
     }
+    free(mrks);
 
-    /* compute standard and jackknifed F statistics for affecteds */
-    fprintf(fpf, "\nAFFECTED (N = %d)\n", ninda[1]);
-    fprintf(fpf,
+    fpf = fopen(argv[optind+3], "w");
+    for (s = 0; s < NSTRAT; s++) {
+        if (s == 0)
+            fprintf(fpf, "TOTAL SAMPLE (N = %d)\n", nindt);
+        else
+            fprintf(fpf, "\n%s (N = %d)\n", s == 1 ? "UNAFFECTED" : "AFFECTED",
+                    ninda[s-1]);
+        fprintf(fpf,
     "MARKER   FIS     FIT     FST     J_FIS   J_SE    J_FIT   J_SE    J_FST   J_SE\n");
-
-    for (j = 0; j < nmrk; j++) {
-        calc_f(j, -1, 2, &ujfis, &ujfit, &ujfst);	/* standard F stats */
-        fis = 0;
-        fit = 0;
-        fst = 0;
-        for (i = 0; i < nindt; i++) {
-            /* jackknifed F stats */
-            if (aff[i] == 2) {
-                err = calc_f(j, i, 2, &jfis[i], &jfit[i], &jfst[i]);
-                if (err) break;
-                fis += jfis[i];
-                fit += jfit[i];
-                fst += jfst[i];
-            }
-        }
-        if (err) {
-            fprintf(fpf,
-                    "%-8s %7.4f %7.4f %7.4f Sample too small for jackknifing.\n",
-                    mrk[j].name, ujfis, ujfit, ujfst);
-        }
-        else {
-            jfisvar = 0;
-            jfitvar = 0;
-            jfstvar = 0;
-            for (i = 0; i < nindt; i++) {
-                if (aff[i] == 2) {
-                    jfisvar += pow(jfis[i] - fis/ninda[1], 2.);
-                    jfitvar += pow(jfit[i] - fit/ninda[1], 2.);
-                    jfstvar += pow(jfst[i] - fst/ninda[1], 2.);
-                }
-            }
-            fprintf(fpf,
-                    "%-8s %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f\n",
-                    mrk[j].name, ujfis, ujfit, ujfst,
-                    ninda[1]*ujfis - (ninda[1]-1)*fis/ninda[1],
-                    sqrt((ninda[1]-1)*jfisvar/ninda[1]),
-                    ninda[1]*ujfit - (ninda[1]-1)*fit/ninda[1],
-                    sqrt((ninda[1]-1)*jfitvar/ninda[1]),
-                    ninda[1]*ujfst - (ninda[1]-1)*fst/ninda[1],
-                    sqrt((ninda[1]-1)*jfstvar/ninda[1]));
+        for (j = 0; j < nmrk; j++) {
+            fputs(fline[j*NSTRAT + s], fpf);
+            free(fline[j*NSTRAT + s]);
         }
     }
 
     fclose(fpf);
 
+    if (pairout)
+        write_pairs(pairout, jkblk);
+
     fph = fopen(argv[optind+2], "w");
 
     /* compute heterozygosity for total sample */
@@ -346,19 +400,31 @@ main (int argc, char **argv)
 void
 show_usage (char *prog)
 {
-    printf("usage: %s [-M missval] pedfile genfrq hetout fstout\n\n", prog);
+    printf("usage: %s [-M missval] [-t nthreads] [-P pairout] [-k blksize]\n",
+           prog);
+    printf("          [-L mbytes] pedfile genfrq hetout fstout\n");
+    printf("       %s -G [-M missval] [-t nthreads] [-P pairout] [-k blksize]\n",
+           prog);
+    printf("          [-L mbytes] pedfile locfile hetout fstout\n\n");
     printf("   pedfile      pedigree file\n");
     printf("   genfrq       genotype frequencies file\n");
+    printf("   locfile      locus file\n");
     printf("   hetout       heterozygosity output file\n");
     printf("   fstout       F statistics output file\n");
     printf("\n   options:\n");
     printf("     -M missval   missing allele value in quotes\n");
+    printf("     -t nthreads  number of threads\n");
+    printf("     -P pairout   pairwise population F_st output file\n");
+    printf("     -k blksize   markers per jackknife block (default %d)\n",
+           JKBLK);
+    printf("     -G           heterozygosity from genotypes, not genfrq\n");
+    printf("     -L mbytes    hold the genotypes in about mbytes MB of memory\n");
     exit(1);
 }
 
 void read_genfreq_file (char *frqfile)
 {
-    int i, j, line;
+    int line;
     int imrk, ipop, a1, a2;
     double gfreq;
     char currmrk[1000];
@@ -386,21 +452,7 @@ void read_genfreq_file (char *frqfile)
         }
     }
 
-    mrk = (struct Marker *) allocMem(nmrk*sizeof(struct Marker));
-    het = (double *) allocMem(nmrk*sizeof(double));
-    var = (double *) allocMem(nmrk*sizeof(double));
-    phet = (double **) allocMem(nmrk*sizeof(double));
-    for (i = 0; i < nmrk; i++)
-        phet[i] = (double *) allocMem(MXPOP*sizeof(double));
- 
-    for (i = 0; i < nmrk; i++)
-        het[i] = 0;
-
-    for (i = 0; i < MXPOP; i++) {
-        nindp[i] = 0;
-        for (j = 0; j < nmrk; j++)
-            phet[j][i] = 0;
-    }
+    alloc_het();
 
     rewind(fp);
     imrk = -1;
@@ -488,11 +540,59 @@ void read_genfreq_file (char *frqfile)
     fclose(fp);
 }
 
+/*
+ *  With -G, the locus file takes the place of the genotype frequencies
+ *  file, and supplies only the marker names. The alleles and
+ *  populations are then named in the order in which they are first
+ *  seen in the pedigree file.
+ */
+
+void read_locus_file (char *locfile)
+{
+    char rec[10000];
+    char buf[10000];
+    int i;
+    FILE *fp;
+
+    fp = fopen(locfile, "r");
+    if (!fp) {
+        fprintf(stderr, "cannot open locus file %s\n", locfile);
+        exit(1);
+    }
+
+    nmrk = 0;
+    while (fgets(rec, sizeof(rec), fp)) {
+        if (sscanf(rec, "%s %s", buf, buf) == 1)
+            nmrk++;
+    }
+
+    alloc_het();
+
+    rewind(fp);
+    fgets(rec, sizeof(rec), fp);
+    for (i = 0; i < nmrk; i++) {
+        mrk[i].name = (char *) allocMem(strlen(rec) + 1);
+        sscanf(rec, "%s", mrk[i].name);
+        mrk[i].nall = 0;
+        while (fgets(rec, sizeof(rec), fp) &&
+               sscanf(rec, "%s %s", buf, buf) == 2) ;
+    }
+
+    fclose(fp);
+}
+
+/*
+ *  With -G, heterozygosity is computed here from the genotypes as they
+ *  are read: the fraction of individuals typed for both alleles who
+ *  are heterozygous, in the total sample and in each population.
+ */
+
 void read_pedigree_file (char *pedfile, char *missval)
 {
-    int i, j, line;
+    int i, j, a, line, recsz = 0;
     int famid, id, sex;
-    char *recp, rec[1024];
+    int *ntyp = 0;
+    char *recp, *rec;
     FILE *fp;
 
     fp = fopen(pedfile, "r");
@@ -502,7 +602,7 @@ void read_pedigree_file (char *pedfile, char *missval)
     }
 
     nindt = 0;
-    while (fgets(rec, sizeof(rec), fp)) {
+    while (read_record(fp, &rec, &recsz)) {
         nindt++;
     }
 
@@ -510,18 +610,21 @@ void read_pedigree_file (char *pedfile, char *missval)
 
     pop = (int *) allocMem(nindt*sizeof(int));
     aff = (int *) allocMem(nindt*sizeof(int));
-
-    all1 = (int **) allocMem(nindt*sizeof(int *));
-    all2 = (int **) allocMem(nindt*sizeof(int *));
-    for (i = 0; i < nindt; i++) {
-        all1[i] = (int *) allocMem(nmrk*sizeof(int));
-        all2[i] = (int *) allocMem(nmrk*sizeof(int));
+    if (genos) {
+        ntyp = (int *) allocMem((nmrk*(MXPOP + 1) + 1)*sizeof(int));
+        for (j = 0; j < nmrk*(MXPOP + 1); j++)
+            ntyp[j] = 0;
     }
 
+    if (memlimit)
+        gm_spill(&geno, nmrk, nindt, memlimit);
+    else
+        gm_alloc(&geno, nmrk, nindt);
+
     rewind(fp);
     i = 0;
     line = 0;
-    while (fgets(rec, sizeof(rec), fp)) {
+    while (read_record(fp, &rec, &recsz)) {
         line++;
 
         if (!(recp = strtok(rec, " \t\n"))) {
@@ -561,7 +664,14 @@ void read_pedigree_file (char *pedfile, char *missval)
                    line);
             exit(1);
         }
-        if ((pop[i] = get_ndx(recp, pops, npop)) == -1) {
+        if ((pop[i] = get_ndx(recp, pops, npop)) == -1 && genos) {
+            if (npop == MXPOP) {
+                fprintf(stderr, "too many populations, MXPOP = %d\n", MXPOP);
+                exit(1);
+            }
+            pop[i] = add_name(recp, &pops, &npop);
+        }
+        else if (pop[i] == -1) {
             fprintf(stderr,
         "%s: population identifier %s not found in genotype frequencies file, line %d\n",
                     pedfile, recp, line);
@@ -584,6 +694,8 @@ void read_pedigree_file (char *pedfile, char *missval)
         }
 
         /* read in the marker alleles */
+        if (memlimit)
+            gm_stage(&geno, i);
         for (j = 0; j < nmrk; j++) {
             if (!(recp = strtok(NULL, " \t\n"))) {
                 fprintf(stderr, "%s: missing allele, marker %s, line %d\n",
@@ -592,10 +704,18 @@ void read_pedigree_file (char *pedfile, char *missval)
             }
             if (!strcmp(recp, missval))
             {
-                all1[i][j] = -1;
+                GM_ALL1(&geno, j)[i] = GM_MISSING;
             }
-            else if ((all1[i][j] =
-                 get_ndx(recp, mrk[j].alleles, mrk[j].nall)) == -1)
+            else if ((a = get_ndx(recp, mrk[j].alleles, mrk[j].nall)) != -1)
+            {
+                GM_ALL1(&geno, j)[i] = a;
+            }
+            else if (genos)
+            {
+                GM_ALL1(&geno, j)[i] = add_name(recp, &mrk[j].alleles,
+                                                &mrk[j].nall);
+            }
+            else
             {
                 fprintf(stderr,
     "%s: marker %s allele %s not found in genotype frequencies file, line %d\n",
@@ -610,10 +730,18 @@ void read_pedigree_file (char *pedfile, char *missval)
             }
             if (!strcmp(recp, missval))
             {
-                all2[i][j] = -1;
+                GM_ALL2(&geno, j)[i] = GM_MISSING;
+            }
+            else if ((a = get_ndx(recp, mrk[j].alleles, mrk[j].nall)) != -1)
+            {
+                GM_ALL2(&geno, j)[i] = a;
             }
-            else if ((all2[i][j] =
-                 get_ndx(recp, mrk[j].alleles, mrk[j].nall)) == -1)
+            else if (genos)
+            {
+                GM_ALL2(&geno, j)[i] = add_name(recp, &mrk[j].alleles,
+                                                &mrk[j].nall);
+            }
+            else
             {
                 fprintf(stderr,
     "%s: marker %s allele %s not found in genotype frequencies file, line %d\n",
@@ -626,72 +754,375 @@ void read_pedigree_file (char *pedfile, char *missval)
                         mrk[j].name, MXALL);
                 exit(1);
             }
+
+            if (genos && GM_ALL1(&geno, j)[i] != GM_MISSING
+                      && GM_ALL2(&geno, j)[i] != GM_MISSING) {
+                ntyp[j*(MXPOP + 1)]++;
+                ntyp[j*(MXPOP + 1) + pop[i] + 1]++;
+                if (GM_ALL1(&geno, j)[i] != GM_ALL2(&geno, j)[i]) {
+                    het[j]++;
+                    phet[j][pop[i]]++;
+                }
+            }
         }
 
+        if (genos)
+            nindp[pop[i]]++;
         i++;
     }
 
     fclose(fp); 
+    free(rec);
+
+    if (genos) {
+        for (j = 0; j < nmrk; j++) {
+            if (ntyp[j*(MXPOP + 1)])
+                het[j] /= ntyp[j*(MXPOP + 1)];
+            for (a = 0; a < npop; a++) {
+                if (ntyp[j*(MXPOP + 1) + a + 1])
+                    phet[j][a] /= ntyp[j*(MXPOP + 1) + a + 1];
+            }
+        }
+        free(ntyp);
+    }
+}
+
+/*
+ *  Compute the F statistics for block k of MRKBLK markers of a job. Each
+ *  marker's output lines go to its own slots in fline, so blocks are
+ *  independent and the output does not depend on the order in which they
+ *  are run.
+ */
+
+void fst_task (int k, void *arg)
+{
+    struct FstJob *job = (struct FstJob *) arg;
+    int j, last;
+    double *jf;
+
+    jf = (double *) allocMem((3*nindt + 1)*sizeof(double));
+    last = min(job->lo + (k + 1)*MRKBLK, job->hi);
+    for (j = job->lo + k*MRKBLK; j < last; j++)
+        do_fstats(j, jf, &job->fline[j*NSTRAT]);
+    free(jf);
+}
+
+/*
+ *  Compute the standard and jackknifed F statistics at marker m for
+ *  every stratum, and format the output line for each stratum into
+ *  line[stratum]. The counts for all strata are tallied in a single
+ *  sweep over the individuals. jf is workspace for 3*nindt values.
+ */
+
+void do_fstats (int m, double *jf, char **line)
+{
+    int i, s, n, err;
+    double fis, ujfis, *jfis, jfisvar;
+    double fit, ujfit, *jfit, jfitvar;
+    double fst, ujfst, *jfst, jfstvar;
+    struct Counts cnt[NSTRAT];
+    char buf[200];
+
+    jfis = jf;
+    jfit = jf + nindt;
+    jfst = jf + 2*nindt;
+
+    tally_counts(m, cnt);
+    if (pnum)
+        pair_terms(m, &cnt[0]);
+
+    for (s = 0; s < NSTRAT; s++) {
+        n = s ? ninda[s-1] : nindt;
+
+        /* standard F stats */
+        if (calc_f(m, &cnt[s], &ujfis, &ujfit, &ujfst)) {
+            sprintf(buf, "Sample too small for F statistics.\n");
+            line[s] = (char *) allocMem(strlen(mrk[m].name) + strlen(buf) + 10);
+            sprintf(line[s], "%-8s %s", mrk[m].name, buf);
+            continue;
+        }
+
+        /* jackknifed F stats */
+        err = 0;
+        fis = 0;
+        fit = 0;
+        fst = 0;
+        for (i = 0; i < nindt; i++) {
+            if (s && aff[i] != s)
+                continue;
+            add_ind(m, i, -1, &cnt[s]);
+            err = calc_f(m, &cnt[s], &jfis[i], &jfit[i], &jfst[i]);
+            add_ind(m, i, 1, &cnt[s]);
+            if (err) break;
+            fis += jfis[i];
+            fit += jfit[i];
+            fst += jfst[i];
+        }
+
+        if (err) {
+            sprintf(buf, "%7.4f %7.4f %7.4f Sample too small for jackknifing.\n",
+                    ujfis, ujfit, ujfst);
+        }
+        else {
+            jfisvar = 0;
+            jfitvar = 0;
+            jfstvar = 0;
+            for (i = 0; i < nindt; i++) {
+                if (s && aff[i] != s)
+                    continue;
+                jfisvar += pow(jfis[i] - fis/n, 2.);
+                jfitvar += pow(jfit[i] - fit/n, 2.);
+                jfstvar += pow(jfst[i] - fst/n, 2.);
+            }
+            sprintf(buf,
+                    "%7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f %7.4f\n",
+                    ujfis, ujfit, ujfst,
+                    n*ujfis - (n-1)*fis/n, sqrt((n-1)*jfisvar/n),
+                    n*ujfit - (n-1)*fit/n, sqrt((n-1)*jfitvar/n),
+                    n*ujfst - (n-1)*fst/n, sqrt((n-1)*jfstvar/n));
+        }
+        line[s] = (char *) allocMem(strlen(mrk[m].name) + strlen(buf) + 10);
+        sprintf(line[s], "%-8s %s", mrk[m].name, buf);
+    }
+}
+
+/*
+ *  Count the alleles and homozygotes at marker m, by population, for
+ *  each stratum: c[0] for all individuals, c[1] for unaffecteds and
+ *  c[2] for affecteds.
+ */
+
+void tally_counts (int m, struct Counts *c)
+{
+    int i, j, s;
+
+    for (s = 0; s < NSTRAT; s++) {
+        for (i = 0; i < npop; i++) {
+            c[s].nidp[i] = 0;
+            for (j = 0; j < MXALL; j++) {
+                c[s].acnt[i][j] = 0;
+                c[s].gcnt[i][j] = 0;
+            }
+        }
+    }
+
+    for (i = 0; i < nindt; i++) {
+        add_ind(m, i, 1, &c[0]);
+        add_ind(m, i, 1, &c[aff[i]]);
+    }
+}
+
+/*
+ *  Compute the numerator and denominator terms of pairwise F_st at
+ *  marker m, for every pair of populations, from the counts for all
+ *  individuals. A pair with an empty population contributes nothing.
+ */
+
+void pair_terms (int m, struct Counts *c)
+{
+    int i, j, k, p, q, n, nall;
+    double sum, hetps, hetpt, x, xbar;
+
+    nall = mrk[m].nall;
+    k = 0;
+    for (p = 0; p < npop; p++) {
+        for (q = p + 1; q < npop; q++, k++) {
+            pnum[m*npair + k] = 0;
+            pden[m*npair + k] = 0;
+            if (!c->nidp[p] || !c->nidp[q])
+                continue;
+
+            /* hetS' */
+            hetps = 0;
+            for (i = p; i <= q; i += q - p) {
+                n = c->nidp[i];
+                sum = 0;
+                for (j = 0; j < nall; j++)
+                    sum += pow((double) c->acnt[i][j]/(2*n), 2.);
+                hetps += (2*n*(1 - sum))/(2*n - 1);
+            }
+            hetps /= 2;
+
+            /* hetT' */
+            hetpt = 0;
+            for (j = 0; j < nall; j++) {
+                sum = 0;
+                xbar = 0;
+                for (i = p; i <= q; i += q - p) {
+                    n = c->nidp[i];
+                    x = (double) c->acnt[i][j]/(2*n);
+                    xbar += x;
+                    sum += x*(1 - x)/(2*n - 1);
+                }
+                xbar /= 2;
+                hetpt += xbar*(1 - xbar) + sum/4;
+            }
+
+            pnum[m*npair + k] = hetpt - hetps;
+            pden[m*npair + k] = hetpt;
+        }
+    }
+}
+
+/*
+ *  Write the genome-wide pairwise F_st estimates, with standard errors
+ *  from a jackknife over blocks of jkblk consecutive markers: each
+ *  block is dropped in turn and the ratio of sums recomputed from the
+ *  remaining markers.
+ */
+
+void write_pairs (char *file, int jkblk)
+{
+    int b, k, m, p, q, nblk;
+    double num, den, bnum, bden, *fmat, *se;
+    double *jf, jfsum, jfvar;
+    FILE *fp;
+
+    fp = fopen(file, "w");
+    if (!fp) {
+        fprintf(stderr, "cannot open %s\n", file);
+        exit(1);
+    }
+
+    nblk = (nmrk + jkblk - 1)/jkblk;
+    fprintf(fp, "PAIRWISE FST (%d MARKERS, %d BLOCKS OF %d)\n", nmrk, nblk,
+            jkblk);
+    if (npop < 2) {
+        fprintf(fp, "Fewer than two populations.\n");
+        fclose(fp);
+        return;
+    }
+
+    fmat = (double *) allocMem((npair + 1)*sizeof(double));
+    se = (double *) allocMem((npair + 1)*sizeof(double));
+    jf = (double *) allocMem((nblk + 1)*sizeof(double));
+
+    fprintf(fp, "POP1     POP2     FST     J_SE\n");
+
+    k = 0;
+    for (p = 0; p < npop; p++) {
+        for (q = p + 1; q < npop; q++, k++) {
+            num = 0;
+            den = 0;
+            for (m = 0; m < nmrk; m++) {
+                num += pnum[m*npair + k];
+                den += pden[m*npair + k];
+            }
+            if (den == 0) {
+                fmat[k] = NAN;
+                fprintf(fp, "%-8s %-8s No polymorphic markers.\n", pops[p],
+                        pops[q]);
+                continue;
+            }
+            fmat[k] = num/den;
+
+            jfsum = 0;
+            for (b = 0; b < nblk; b++) {
+                bnum = 0;
+                bden = 0;
+                for (m = b*jkblk; m < nmrk && m < (b + 1)*jkblk; m++) {
+                    bnum += pnum[m*npair + k];
+                    bden += pden[m*npair + k];
+                }
+                /* a block holding every polymorphic marker leaves none */
+                if (den == bden)
+                    break;
+                jf[b] = (num - bnum)/(den - bden);
+                jfsum += jf[b];
+            }
+            if (nblk < 2 || b < nblk) {
+                fprintf(fp, "%-8s %-8s %7.4f Too few blocks for jackknifing.\n",
+                        pops[p], pops[q], fmat[k]);
+                continue;
+            }
+
+            jfvar = 0;
+            for (b = 0; b < nblk; b++)
+                jfvar += pow(jf[b] - jfsum/nblk, 2.);
+            se[k] = sqrt((nblk - 1)*jfvar/nblk);
+            fprintf(fp, "%-8s %-8s %7.4f %7.4f\n", pops[p], pops[q], fmat[k],
+                    se[k]);
+        }
+    }
+
+    /* the same estimates, as a matrix */
+    fprintf(fp, "\nFST MATRIX\n");
+    fprintf(fp, "%-8s", "");
+    for (q = 0; q < npop; q++)
+        fprintf(fp, " %8s", pops[q]);
+    fprintf(fp, "\n");
+    for (p = 0; p < npop; p++) {
+        fprintf(fp, "%-8s", pops[p]);
+        for (q = 0; q < npop; q++) {
+            k = p < q ? p*npop - p*(p + 1)/2 + q - p - 1
+                      : q*npop - q*(q + 1)/2 + p - q - 1;
+            if (p == q)
+                fprintf(fp, " %8.4f", 0.);
+            else if (isnan(fmat[k]))
+                fprintf(fp, " %8s", "-");
+            else
+                fprintf(fp, " %8.4f", fmat[k]);
+        }
+        fprintf(fp, "\n");
+    }
+
+    fclose(fp);
+    free(fmat);
+    free(se);
+    free(jf);
+}
+
+/*
+ *  Add (n = 1) or remove (n = -1) the genotype of individual i at
+ *  marker m to or from the counts.
+ */
+
+void add_ind (int m, int i, int n, struct Counts *c)
+{
+    int ipop = pop[i];
+    int a1 = GM_ALL1(&geno, m)[i];
+    int a2 = GM_ALL2(&geno, m)[i];
+
+    c->nidp[ipop] += n;
+    if (a1 != GM_MISSING)
+        c->acnt[ipop][a1] += n;
+    if (a2 != GM_MISSING)
+        c->acnt[ipop][a2] += n;
+    if (a1 != GM_MISSING && a1 == a2)
+        c->gcnt[ipop][a1] += n;
 }
 
 /*
  *
  *  Compute locus-specific F statistics, weighted by (1/#populations).
  *
- *     calc_f(m, n, iaff, *fis, *fit, *fst)
+ *     calc_f(m, c, *fis, *fit, *fst)
  *
  *        m     locus
- *        n     population (-1 = include all)
- *        iaff  0 = include all, 1 = unaffect only, 2 = affect only
+ *        c     allele and homozygote counts at locus m
  *        fis   F_is
  *        fit   F_it
  *        fst   F_st
  *
  *     Returns  0 if F statistics computed OK, non-zero otherwise
  *
+ *  Alleles not seen at locus m contribute nothing to the sums, so only
+ *  the marker's own alleles are visited.
+ *
  */
 
-int calc_f (int m, int n, int iaff, double *fis, double *fit, double *fst)
+int calc_f (int m, struct Counts *c, double *fis, double *fit, double *fst)
 {
-    int i, j, ipop;
-    int nidp[MXPOP];
-    int acnt[MXPOP][MXALL];
-    int gcnt[MXPOP][MXALL];
+    int i, j, nall;
+    int *nidp = c->nidp;
+    int (*acnt)[MXALL] = c->acnt;
+    int (*gcnt)[MXALL] = c->gcnt;
 
     double hetp0, hetps, hetpt;
     double sum, hets[MXPOP];
     double x, xbar;
 
-    for (i = 0; i < npop; i++) {
-        nidp[i] = 0;
-        for (j = 0; j < MXALL; j++) {
-            acnt[i][j] = 0;
-            gcnt[i][j] = 0;
-        }
-    }
-
-    /* count #individuals by population
-       count #alleles and #homozygotes at locus m by population */
-
-    for (i = 0; i < nindt; i++) {
-
-        /* drop individual n */
-        if (i == n)
-            continue;
-
-        /* include/exclude by affection status */
-        if (iaff && aff[i] != iaff)
-            continue;
-
-        ipop = pop[i];
-        nidp[ipop]++;
-        if (all1[i][m] != -1)
-            acnt[ipop][all1[i][m]]++;
-        if (all2[i][m] != -1)
-            acnt[ipop][all2[i][m]]++;
-        if (all1[i][m] != -1 && all1[i][m] == all2[i][m])
-            gcnt[ipop][all1[i][m]]++;
-    }
+    nall = mrk[m].nall;
 
     /* compute hetS_i for all alleles at locus m */
     for (i = 0; i < npop; i++) {
@@ -699,7 +1130,7 @@ int calc_f (int m, int n, int iaff, double *fis, double *fit, double *fst)
             return 1;
         }
         sum = 0;
-        for (j = 0; j < MXALL; j++) {
+        for (j = 0; j < nall; j++) {
             sum += pow((double)acnt[i][j]/(2*nidp[i]), 2.);
         }
         hets[i] = 1 - sum;
@@ -708,7 +1139,7 @@ int calc_f (int m, int n, int iaff, double *fis, double *fit, double *fst)
     /* compute het0' */
     sum = 0;
     for (i = 0; i < npop; i++) {
-        for (j = 0; j < MXALL; j++) {
+        for (j = 0; j < nall; j++) {
             sum += gcnt[i][j]/nidp[i];
         }
     }
@@ -723,7 +1154,7 @@ int calc_f (int m, int n, int iaff, double *fis, double *fit, double *fst)
 
     /* compute hetT' */
     hetpt = 0;
-    for (j = 0; j < MXALL; j++) {
+    for (j = 0; j < nall; j++) {
         sum = 0;
         xbar = 0;
         for (i = 0; i < npop; i++) {
@@ -743,6 +1174,106 @@ int calc_f (int m, int n, int iaff, double *fis, double *fit, double *fst)
     return 0;
 }
 
+/*
+ *  Read genotype frequencies from a binary count store. The strata and
+ *  genotypes are visited in the order in which they occur in the
+ *  genotype frequencies file, so that alleles and populations are
+ *  numbered just as when reading that file.
+ */
+
+void read_store (char *file)
+{
+    int i, j, k, l, s, nall, ncnt, a1, a2, ipop;
+    int32_t *cnt;
+    double *frq;
+    struct CntStore cs;
+
+    cs_open(file, &cs);
+
+    nmrk = cs.nmrk;
+    alloc_het();
+
+    for (i = 0; i < nmrk; i++) {
+        mrk[i].name = cs_marker(&cs, i);
+        mrk[i].nall = 0;
+        nall = cs_nall(&cs, i);
+        ncnt = nall*(nall + 1)/2;
+        frq = (double *) allocMem((ncnt + 1)*sizeof(double));
+
+        /* strata -/pops, then -/- */
+        for (s = 0; s <= cs.npop; s++) {
+            ipop = s < cs.npop ? s : -1;
+            cnt = cs_counts(&cs, i, 0, ipop) + nall;
+            if (!cs_freqs(cnt, ncnt, frq))
+                continue;
+
+            if (ipop != -1 &&
+                    (ipop = get_ndx(cs_pop(&cs, s), pops, npop)) == -1) {
+                if (npop == MXPOP) {
+                    fprintf(stderr, "too many populations, MXPOP = %d\n",
+                            MXPOP);
+                    exit(1);
+                }
+                ipop = add_name(cs_pop(&cs, s), &pops, &npop);
+            }
+
+            /* genotype l/k, l <= k, is at k*(k+1)/2 + l */
+            for (j = 0, k = 0, l = 0; j < ncnt; j++) {
+                if (cnt[j]) {
+                    if ((a1 = get_ndx(cs_allele(&cs, i, l), mrk[i].alleles,
+                                      mrk[i].nall)) == -1)
+                        a1 = add_name(cs_allele(&cs, i, l), &mrk[i].alleles,
+                                      &mrk[i].nall);
+                    if ((a2 = get_ndx(cs_allele(&cs, i, k), mrk[i].alleles,
+                                      mrk[i].nall)) == -1)
+                        a2 = add_name(cs_allele(&cs, i, k), &mrk[i].alleles,
+                                      &mrk[i].nall);
+
+                    if (a1 != a2) {
+                        if (ipop == -1)
+                            het[i] += frq[j];
+                        else {
+                            phet[i][ipop] += frq[j];
+                            nindp[ipop]++;
+                        }
+                    }
+                }
+                if (++l > k) {
+                    k++;
+                    l = 0;
+                }
+            }
+        }
+
+        free(frq);
+    }
+}
+
+/*
+ *  Allocate the marker list and heterozygosity arrays for nmrk markers.
+ */
+
+void alloc_het (void)
+{
+    int i, j;
+
+    mrk = (struct Marker *) allocMem(nmrk*sizeof(struct Marker));
+    het = (double *) allocMem(nmrk*sizeof(double));
+    var = (double *) allocMem(nmrk*sizeof(double));
+    phet = (double **) allocMem(nmrk*sizeof(double));
+    for (i = 0; i < nmrk; i++)
+        phet[i] = (double *) allocMem(MXPOP*sizeof(double));
+ 
+    for (i = 0; i < nmrk; i++)
+        het[i] = 0;
+
+    for (i = 0; i < MXPOP; i++) {
+        nindp[i] = 0;
+        for (j = 0; j < nmrk; j++)
+            phet[j][i] = 0;
+    }
+}
+
 int
 get_ndx (char *str, char **array, int nelem)
 {
@@ -759,6 +1290,9 @@ get_ndx (char *str, char **array, int nelem)
 int
 add_name (char *str, char ***array, int *nelem)
 {
+    int nblk;
+    char **p;
+
     if (!*nelem) {
         *array = (char **) malloc(ALLBLK*sizeof(char *));
         if (!*array) {
@@ -766,12 +1300,14 @@ add_name (char *str, char ***array, int *nelem)
             exit(1);
         }
     }
-    else if (!(*nelem)%ALLBLK) {
-        *array = (char **) realloc(*array, ALLBLK*sizeof(char *));
-        if (!*array) {
+    else if (!(*nelem%ALLBLK)) {
+        nblk = (*nelem)/ALLBLK + 1;
+        p = (char **) realloc(*array, nblk*ALLBLK*sizeof(char *));
+        if (!p) {
             fprintf(stderr, "not enough memory\n");
             exit(1);
         }
+        *array = p;
     }
 
     (*array)[*nelem] = (char *) allocMem(strlen(str)+1);
@@ -781,6 +1317,35 @@ add_name (char *str, char ***array, int *nelem)
     return *nelem - 1;
 }
 
+/*
+ *  Read one line of arbitrary length into a buffer which is grown as
+ *  needed. Returns the length of the line, or 0 at end of file.
+ */
+
+int
+read_record (FILE *fp, char **buf, int *size)
+{
+    int len;
+
+    if (!*size) {
+        *size = 10000;
+        *buf = (char *) allocMem(*size);
+    }
+
+    len = 0;
+    while (fgets(*buf + len, *size - len, fp)) {
+        len += strlen(*buf + len);
+        if ((*buf)[len-1] == '\n')
+            break;
+        if (len == *size - 1) {
+            *size *= 2;
+            *buf = (char *) growMem(*buf, *size);
+        }
+    }
+
+    return len;
+}
+
 void
 *allocMem (size_t nbytes)
 {
@@ -792,3 +1357,14 @@ void
     }
     return ptr;
 }
+
+void
+*growMem (void *ptr, size_t nbytes)
+{
+    ptr = (void *) realloc(ptr, nbytes);
+    if (!ptr) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+    return ptr;
+}
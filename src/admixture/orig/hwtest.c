@@ -15,9 +15,11 @@
  *
  *
  * Usage:  hwtest [-au] [-p pop_id] [-o outfile] allfrq genfrq marker
+ *         hwtest [-au] [-p pop_id] [-o outfile] cntstore marker
  *
  *         allfrq       allele frequencies input file
  *         genfrq       genotype frequencies input file
+ *         cntstore     binary count store (count -b)
  *         marker       marker to be tested
  *
  *         options:
@@ -29,6 +31,9 @@
  *   Note that if the marker being tested has more than 2 alleles, in
  *   which case program HWE will be run, an output file must be specified.
  *
+ *   If a binary count store is given in place of the two frequency
+ *   files, only the counts for the marker being tested are read.
+ *
  *
  * File formats:
  *
@@ -68,6 +73,9 @@
 #include <stdlib.h>
 #include <math.h>
 
+#include "cntstore.h"
+#include "chisq.h"
+
 #define MXALL	40	/* max # alleles per marker	*/
 
 #define ALLBLK  256	/* # array elements malloc'd at a time		*/
@@ -96,6 +104,7 @@ char *pop_id = 0;
 void show_usage (char *);
 void read_allfreq_file (char *);
 void read_genfreq_file (char *);
+void read_store (char *, char *);
 int get_ndx (char *, char **, int);
 int add_name (char *, char ***, int *);
 void *allocMem (size_t);
@@ -107,7 +116,7 @@ main (int argc, char **argv)
     int mrkn, nall;
     double freq;
     double n, n_A, n_a, n_AA, n_Aa, n_aa;
-    double chi, df = 1, pchis_();
+    double chi;
     char cmd[1000];
     char *recp, rec[10000];
     char *ofile = 0;
@@ -142,24 +151,31 @@ main (int argc, char **argv)
         }
     }
 
-    if (argc - optind != 3 || errflg) {
+    if (errflg || (argc - optind != 3 && (argc - optind != 2
+                                          || !cs_is_store(argv[optind])))) {
         show_usage(argv[0]);
         exit(1);
     }
 
-    read_allfreq_file(argv[optind]);
+    if (argc - optind == 2) {
+        read_store(argv[optind], argv[optind+1]);
+        mrkn = 0;
+    }
+    else {
+        read_allfreq_file(argv[optind]);
 
-    mrkn = -1;
-    for (i = 0; i < nmrk; i++) {
-        if (!strcmp(argv[optind+2], mrk[i].name)) {
-            mrkn = i;
-            break;
+        mrkn = -1;
+        for (i = 0; i < nmrk; i++) {
+            if (!strcmp(argv[optind+2], mrk[i].name)) {
+                mrkn = i;
+                break;
+            }
+        }
+        if (mrkn == -1) {
+            fprintf(stderr, "marker %s not found in allele frequency file\n",
+                    argv[optind+2]);
+            exit(1);
         }
-    }
-    if (mrkn == -1) {
-        fprintf(stderr, "marker %s not found in allele frequency file\n",
-                argv[optind+2]);
-        exit(1);
     }
 
     if (!mrk[mrkn].nall) {
@@ -168,7 +184,8 @@ main (int argc, char **argv)
         exit(1);
     }
 
-    read_genfreq_file(argv[optind+1]);
+    if (argc - optind == 3)
+        read_genfreq_file(argv[optind+1]);
 
     /* perform chi-square test of HWE */
     if (mrk[mrkn].nall <= 2)
@@ -205,7 +222,7 @@ main (int argc, char **argv)
         }
         else {
             fprintf(fpo, "%s: chi = %g  p = %g\n", mrk[mrkn].name, chi,
-                    1 - pchis_(&chi, &df));
+                    chi_p(chi, 1));
         }
     }
 
@@ -254,9 +271,11 @@ main (int argc, char **argv)
 void
 show_usage (char *prog)
 {
-    printf("usage: %s [-au] [-p pop_id] allfrq genfrq marker\n\n", prog);
+    printf("usage: %s [-au] [-p pop_id] allfrq genfrq marker\n", prog);
+    printf("       %s [-au] [-p pop_id] cntstore marker\n\n", prog);
     printf("   allfrq       allele frequencies input file\n");
     printf("   genfrq       genotype frequencies input file\n");
+    printf("   cntstore     binary count store\n");
     printf("   marker       marker to be tested\n");
     printf("\n   options:\n");
     printf("     -a           include affecteds only\n");
@@ -489,6 +508,85 @@ void read_genfreq_file (char *frqfile)
     fclose(fp);
 }
 
+/*
+ *  Read the allele and genotype counts of one marker from a binary
+ *  count store. Alleles which do not occur in the selected stratum are
+ *  dropped, just as they are absent from the frequency files.
+ */
+
+void read_store (char *file, char *name)
+{
+    int i, j, k, l, imrk, aff, pop, nall;
+    int ndx[MXALL];
+    int32_t *cnt;
+    struct CntStore cs;
+
+    cs_open(file, &cs);
+
+    imrk = cs_find(&cs, name);
+    if (imrk == -1) {
+        fprintf(stderr, "marker %s not found in count store\n", name);
+        exit(1);
+    }
+
+    nmrk = 1;
+    mrk = (struct Marker *) allocMem(sizeof(struct Marker));
+    mrk[0].name = cs_marker(&cs, imrk);
+    mrk[0].nall = 0;
+
+    acnt = (int **) allocMem(sizeof(int *));
+    acnt[0] = (int *) allocMem(MXALL*sizeof(int));
+    gcnt = (int ***) allocMem(sizeof(int **));
+    gcnt[0] = (int **) allocMem(MXALL*sizeof(int *));
+    for (i = 0; i < MXALL; i++) {
+        acnt[0][i] = 0;
+        gcnt[0][i] = (int *) allocMem(MXALL*sizeof(int));
+        for (j = 0; j < MXALL; j++)
+            gcnt[0][i][j] = 0;
+    }
+
+    if (unaff_only)
+        aff = 1;
+    else if (aff_only)
+        aff = 2;
+    else
+        aff = 0;
+
+    pop = -1;
+    if (pop_id) {
+        for (i = 0; i < cs.npop; i++) {
+            if (!strcmp(pop_id, cs_pop(&cs, i)))
+                break;
+        }
+        if (i == cs.npop)
+            return;
+        pop = i;
+    }
+
+    nall = cs_nall(&cs, imrk);
+    cnt = cs_counts(&cs, imrk, aff, pop);
+    for (k = 0; k < nall; k++) {
+        if (!cnt[k])
+            continue;
+        if (mrk[0].nall == MXALL) {
+            fprintf(stderr, "marker %s: too many alleles, MXALL = %d\n",
+                    name, MXALL);
+            exit(1);
+        }
+        ndx[mrk[0].nall] = k;
+        acnt[0][mrk[0].nall] = cnt[k];
+        add_name(cs_allele(&cs, imrk, k), &mrk[0].alleles, &mrk[0].nall);
+    }
+
+    for (i = 0; i < mrk[0].nall; i++) {
+        for (j = 0; j <= i; j++) {
+            k = ndx[i];
+            l = ndx[j];
+            gcnt[0][j][i] = cnt[nall + k*(k+1)/2 + l];
+        }
+    }
+}
+
 int
 get_ndx (char *str, char **array, int nelem)
 {
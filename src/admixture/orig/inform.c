@@ -15,8 +15,8 @@
  * populations.
  *
  *
- * Usage:  inform [-aq] [-p plist] [-m mlist] [-g gridint] [-o outfile]
- *                locfile [m1 ...]
+ * Usage:  inform [-aq] [-p plist] [-m mlist] [-g gridint] [-r nref [-t tol]]
+ *                [-w wsize [-s step]] [-o outfile] locfile [m1 ...]
  *
  *         locfile      population-specific allele frequencies
  *         m1 ...       admixture proportions (optional)
@@ -26,6 +26,10 @@
  *           -m mlist     read sets of markers from file mlist
  *           -a           use all markers simultaneously
  *           -g gridint   grid interval
+ *           -r nref      refine the grid adaptively up to nref times
+ *           -t tol       grid refinement tolerance (default 0.05)
+ *           -w wsize     scan windows of wsize consecutive markers
+ *           -s step      # markers between window starts (default 1)
  *           -o outfile   output file
  *           -q           suppress warning messages
  *
@@ -33,6 +37,25 @@
  *   informativeness is calculated at each point in an equally-spaced
  *   grid of proportions.
  *
+ *   With the -r option, the grid is refined adaptively. The grid cells
+ *   are halved, up to nref times, wherever the informativeness varies by
+ *   more than a fraction tol of its overall range, comes within that
+ *   fraction of the smallest value found, or is undefined at some of the
+ *   cell corners. Every grid point evaluated is reported, followed by
+ *   the minimum informativeness and the proportions at which it occurs.
+ *
+ *   With the -w option, informativeness is calculated for each window
+ *   of wsize consecutive markers, in locus file order, with successive
+ *   windows starting step markers apart. One line is written for each
+ *   window at each set of admixture proportions, giving the proportions,
+ *   the first and last markers in the window, and the informativeness.
+ *   The -w option cannot be combined with -m or -a.
+ *
+ *   Each line of the marker list file is one set of markers, given as
+ *   blank- or tab-delimited marker names. The sets are read and evaluated
+ *   one line at a time, so lines may be of any length and the number of
+ *   sets is not limited by available memory.
+ *
  *
  * File formats:
  *
@@ -62,6 +85,10 @@
 
 #define TINY	0.0000001
 
+#define INF_OK		0	/* informativeness computed		*/
+#define INF_UNDEF	1	/* information undefined		*/
+#define INF_SINGULAR	2	/* info matrix can't be factored	*/
+
 struct Marker {
     char *name;			/* marker name			*/
     int nall;			/* number of alleles		*/
@@ -74,32 +101,67 @@ int npop;		/* number of populations	*/
 int nmrk;		/* number of markers		*/
 struct Marker *mrk;
 
+struct Point {
+    unsigned long key;		/* lattice coordinates		*/
+    int status;			/* INF_OK, INF_UNDEF, ...	*/
+    double val;			/* informativeness		*/
+} ;
+
+int npoint, ptsize;	/* adaptive grid points		*/
+double ptunit;		/* lattice spacing of the finest grid	*/
+struct Point *points;
+int phsize;		/* size of point hash table	*/
+int *phash;		/* point hash table		*/
+
+int nhash;		/* size of marker name hash table	*/
+int *mhash;		/* marker name hash table		*/
+
 float gridint = .01;
+int wsize = 0;		/* window size (markers), 0 = no window scan	*/
+int wstep = 1;		/* # markers between window starts		*/
+int nref = 0;		/* # adaptive grid refinements, 0 = none	*/
+double reftol = .05;	/* adaptive grid refinement tolerance		*/
 double *delta, *info, *work;
 int *ipvt;
 
+void inform_set (int, int, double **, int, int *, FILE *);
 void compute_inform (int, int, double **, int, int *, FILE *);
+int eval_inform (double *, int, int *, double *);
+void refine_inform (int, int *, FILE *);
+struct Point *get_point (long *, long, int, int *, double *);
+void print_point (struct Point *, long, FILE *);
+int cmp_point (const void *, const void *);
+int marker_inform (int, double *, double *);
+int next_grid_point (double *);
+void scan_windows (int, int, double **, FILE *);
 void show_usage (char *);
 void read_locus_file (char *, int);
+int read_record (FILE *, char **, int *);
+void build_marker_index (void);
+int find_marker (char *);
+unsigned int hash_name (char *);
 int add_name (char *, char ***, int *);
 void *allocMem (size_t);
+void *growMem (void *, size_t);
 
 
 main(int argc, char **argv)
 {
     int i, j, line;
     int npop1;
-    int grid, nprp, ntst, *nmtst, **mtst;
+    int grid, nprp, ntst, nmtst, *mtst, *inset;
     int errflg = 0, useall = 0, nowarn = 0;
     double **m, sum;
     char *mfile = 0, *pfile = 0, *ofile = 0;
     char *recp, rec[10000];
+    char *mrec;
+    int mrecsz;
     FILE *pfp, *mfp, *ofp;
     extern char *optarg;
     extern int optind, optopt;
 
     /* gather command line arguments */
-    while ((i = getopt(argc, argv, ":aqm:p:g:o:")) != -1) {
+    while ((i = getopt(argc, argv, ":aqm:p:g:o:w:s:r:t:")) != -1) {
         switch (i) {
         case 'a':
             useall = 1;
@@ -123,6 +185,34 @@ main(int argc, char **argv)
                 errflg++;
             }
             break;
+        case 'w':
+            if (sscanf(optarg, "%d", &wsize) != 1 || wsize < 1) {
+                fprintf(stderr,
+                        "option -%c requires a positive integer operand\n", i);
+                errflg++;
+            }
+            break;
+        case 's':
+            if (sscanf(optarg, "%d", &wstep) != 1 || wstep < 1) {
+                fprintf(stderr,
+                        "option -%c requires a positive integer operand\n", i);
+                errflg++;
+            }
+            break;
+        case 'r':
+            if (sscanf(optarg, "%d", &nref) != 1 || nref < 1 || nref > 16) {
+                fprintf(stderr,
+                "option -%c requires an integer operand between 1 and 16\n", i);
+                errflg++;
+            }
+            break;
+        case 't':
+            if (sscanf(optarg, "%lf", &reftol) != 1 || reftol < 0) {
+                fprintf(stderr,
+                        "option -%c requires a floating point operand\n", i);
+                errflg++;
+            }
+            break;
         case ':':
             fprintf(stderr, "option -%c requires an operand\n", optopt);
             errflg++;
@@ -137,9 +227,25 @@ main(int argc, char **argv)
         show_usage(argv[0]);
     }
 
+    if (nref && wsize) {
+        fprintf(stderr, "option -r cannot be combined with -w\n");
+        exit(1);
+    }
+
+    if (wsize && (mfile || useall)) {
+        fprintf(stderr, "option -w cannot be combined with -m or -a\n");
+        exit(1);
+    }
+
     read_locus_file(argv[optind], nowarn);
     npop1 = npop - 1;
 
+    if (wsize > nmrk) {
+        fprintf(stderr, "window size %d exceeds the number of markers, %d\n",
+                wsize, nmrk);
+        exit(1);
+    }
+
     nprp = 0;
     if (pfile || (argc - optind == npop)) {
         grid = 0;
@@ -165,6 +271,12 @@ main(int argc, char **argv)
         show_usage(argv[0]);
     }
 
+    if (nref && !grid) {
+        fprintf(stderr,
+            "option -r cannot be used when admixture proportions are given\n");
+        exit(1);
+    }
+
     /* allocate and initialize storage */
     if (grid) {
         m = (double **) allocMem(sizeof(double *));
@@ -243,138 +355,121 @@ main(int argc, char **argv)
         }
     }
 
-    /* set up storage for a list of the sets of markers to be tested */
-    if (!mfile && !useall) {
-        ntst = nmrk;
-        mtst = (int **) allocMem(ntst*sizeof(int *));
-        nmtst = (int *) allocMem(ntst*sizeof(int));
-        for (i = 0; i < ntst; i++) {
-            mtst[i] = (int *) allocMem(sizeof(int));
-            mtst[i][0] = i;
-            nmtst[i] = 1;
+    delta = (double *) allocMem(npop1*sizeof(double));
+    info = (double *) allocMem(npop1*npop1*sizeof(double));
+    ipvt = (int *) allocMem(npop1*sizeof(int));
+    work = (double *) allocMem(npop1*sizeof(double));
+
+    if (ofile) {
+        ofp = fopen(ofile, "w");
+        if (!ofp) {
+            fprintf(stderr, "cannot open output file %s\n", ofile);
+            exit(1);
         }
     }
-    else {
-        ntst = 0;
-        if (useall) ntst++;
+    else
+        ofp = stdout;
 
-        if (mfile) {
-            mfp = fopen(mfile, "r");
-            if (!mfp) {
-                fprintf(stderr, "cannot open marker list %s\n", mfile);
-                exit(1);
-            }
-            while (fgets(rec, sizeof(rec), mfp)) {
-                ntst++;
-            }
-            rewind(mfp);
-        }
+/*
+ *  For each set of markers to be tested, compute the informativeness of that
+ *  set of markers for admixture, either over a grid of admixture proportions
+ *  or at each of a specified set of proportions. In a window scan, the sets
+ *  are the windows of consecutive markers in locus file order.
+ */
+    if (wsize) {
+        scan_windows (grid, nprp, m, ofp);
+        fclose(ofp);
+        exit(0);
+    }
 
-        mtst = (int **) allocMem(ntst*sizeof(int *));
-        nmtst = (int *) allocMem(ntst*sizeof(int));
-        for (i = 0; i < ntst; i++) {
-            mtst[i] = (int *) allocMem(nmrk*sizeof(int));
-        }
+    /* a single buffer holds the current marker set; sets from the marker
+       list file are resolved and evaluated one line at a time */
+    mtst = (int *) allocMem(nmrk*sizeof(int));
+    ntst = 0;
 
-        if (useall) {
-            nmtst[0] = nmrk;
-            for (i = 0; i < nmrk; i++) {
-                mtst[0][i] = i;
-            }
+    if (useall) {
+        for (i = 0; i < nmrk; i++) {
+            mtst[i] = i;
         }
+        inform_set (grid, nprp, m, nmrk, mtst, ofp);
+        ntst++;
     }
 
-    /* if necessary, read marker sets from input file */
     if (mfile) {
-        ntst = 0;
-        if (useall) ntst++;
+        mfp = fopen(mfile, "r");
+        if (!mfp) {
+            fprintf(stderr, "cannot open marker list %s\n", mfile);
+            exit(1);
+        }
 
-        while (fgets(rec, sizeof(rec), mfp)) {
-            recp = strtok(rec, " \t\n");
+        build_marker_index();
+        inset = (int *) allocMem(nmrk*sizeof(int));
+        for (i = 0; i < nmrk; i++) {
+            inset[i] = -1;
+        }
+
+        mrec = 0;
+        mrecsz = 0;
+        while (read_record(mfp, &mrec, &mrecsz)) {
+            recp = strtok(mrec, " \t\n");
             if (!recp) continue;	/* skip blank line */
 
-            mtst[ntst][0] = -1;
-            for (j = 0; j < nmrk; j++) {
-                if (!strcmp(recp, mrk[j].name)) {
-                    mtst[ntst][0] = j;
-                    break;
-                }
-            }
-            if (mtst[ntst][0] == -1) {
-                fprintf(stderr,
-                        "marker %s not found in frequencies file\n", argv[optind]);
-                exit(1);
-            }
-            nmtst[ntst] = 1;
-
-            while (recp = strtok(NULL, " \t\n")) {
-                mtst[ntst][nmtst[ntst]] = -1;
-                for (j = 0; j < nmrk; j++) {
-                    if (!strcmp(recp, mrk[j].name)) {
-                        mtst[ntst][nmtst[ntst]] = j;
-                        break;
-                    }
-                }
-                if (mtst[ntst][nmtst[ntst]] == -1) {
+            nmtst = 0;
+            do {
+                if ((j = find_marker(recp)) == -1) {
                     fprintf(stderr,
                             "marker %s not found in frequencies file\n", recp);
                     exit(1);
                 }
-                for (j = 0; j < nmtst[ntst]; j++) {
-                    if (mtst[ntst][nmtst[ntst]] == mtst[ntst][j]) {
-                        fprintf(stderr,
+                if (inset[j] == ntst) {
+                    fprintf(stderr,
     "marker %s occurs more than once in marker set %d, but was used only once\n",
-                                recp, ntst + 1);
-                        break;
-                    }
-                }
-                if (j == nmtst[ntst]) {
-                    nmtst[ntst]++;
+                            recp, ntst + 1);
+                    continue;
                 }
-            }
+                inset[j] = ntst;
+                mtst[nmtst++] = j;
+            } while (recp = strtok(NULL, " \t\n"));
+
+            if (ntst) fprintf(ofp, "\n");
+            inform_set (grid, nprp, m, nmtst, mtst, ofp);
             ntst++;
         }
 
         fclose(mfp);
     }
 
-    delta = (double *) allocMem(npop1*sizeof(double));
-    info = (double *) allocMem(npop1*npop1*sizeof(double));
-    ipvt = (int *) allocMem(npop1*sizeof(int));
-    work = (double *) allocMem(npop1*sizeof(double));
-
-    if (ofile) {
-        ofp = fopen(ofile, "w");
-        if (!ofp) {
-            fprintf(stderr, "cannot open output file %s\n", ofile);
-            exit(1);
+    if (!mfile && !useall) {
+        for (i = 0; i < nmrk; i++) {
+            mtst[0] = i;
+            if (i) fprintf(ofp, "\n");
+            inform_set (grid, nprp, m, 1, mtst, ofp);
         }
     }
-    else
-        ofp = stdout;
+
+    fclose(ofp);
+}
 
 /*
- *  For each set of markers to be tested, compute the informativeness of that
- *  set of markers for admixture, either over a grid of admixture proportions
- *  or at each of a specified set of proportions.
+ *  Compute the informativeness of a set of markers, over the adaptive
+ *  grid if refinement was requested.
  */
-    compute_inform (grid, nprp, m, nmtst[0], mtst[0], ofp);
-    for (i = 1; i < ntst; i++) {
-        fprintf(ofp, "\n");
-        compute_inform (grid, nprp, m, nmtst[i], mtst[i], ofp);
-    }
 
-    fclose(ofp);
+void
+inform_set (int grid, int nprp, double *m[npop-1], int ntst, int *mtst, FILE *fp)
+{
+    if (nref)
+        refine_inform(ntst, mtst, fp);
+    else
+        compute_inform(grid, nprp, m, ntst, mtst, fp);
 }
 
 void
 compute_inform (int grid, int nprp, double *m[npop-1], int ntst, int *mtst, FILE *fp)
 {
-    int i, ii, j, k, l;
-    int npop1, iprp;
-    int nose, job = 11;
-    int done, ok;
-    double denom, sum, det[2];
+    int i, npop1, iprp;
+    int done, rc;
+    double sum, val;
 
     fprintf(fp, "Marker Set:");
     if (ntst == nmrk)
@@ -393,47 +488,7 @@ compute_inform (int grid, int nprp, double *m[npop-1], int ntst, int *mtst, FILE
     for (iprp = 0; iprp < nprp; iprp++) {
         done = 0;
         while (!done) {
-            for (i = 0; i < npop1; i++) {
-                for (j = 0; j < npop1; j++) {
-                    info[i*npop1+j] = 0;
-                }
-            }
-
-            ok = 1;
-            for (ii = 0; ii < ntst; ii++) {
-                i = mtst[ii];
-                for (j = 0; j < mrk[i].nall; j++) {
-                    sum = 0;
-                    for (k = 0; k < npop; k++)
-                        sum += mrk[i].afreq[k][j];
-                    if (!sum) continue;
-
-                    denom = mrk[i].afreq[npop1][j];
-                    for (k = 0; k < npop1; k++) {
-                        delta[k] = mrk[i].afreq[k][j] - mrk[i].afreq[npop1][j];
-                        denom += m[iprp][k]*delta[k];
-                    }
-                    if (denom > TINY) {
-                        for (k = 0; k < npop1; k++) {
-                            for (l = 0; l < npop1; l++) {
-                                info[k*npop1+l] += 2*delta[k]*delta[l]/denom;
-                            }
-                        }
-                    }
-                    else {
-                        ok = 0;
-                        break;
-                    }
-                }
-                if (!ok) break;
-            }
-
-            if (ok) {
-                dgefa_(info, &npop1, &npop1, ipvt, &nose);
-                if (!nose) {
-                    dgedi_(info, &npop1, &npop1, ipvt, det, work, &job);
-                }
-            }
+            rc = eval_inform(m[iprp], ntst, mtst, &val);
 
             sum = 0;
             for (i = 0; i < npop1; i++) {
@@ -442,40 +497,471 @@ compute_inform (int grid, int nprp, double *m[npop-1], int ntst, int *mtst, FILE
             }
             if (sum > 1) sum = 1;
             fprintf(fp, "%5.3f ", 1 - sum);
-            if (!ok)
+            if (rc == INF_UNDEF)
                 fprintf(fp, "********\n");
-            else if (!nose)
-                fprintf(fp, "%g\n", det[0]*pow(10.,det[1]));
+            else if (rc == INF_OK)
+                fprintf(fp, "%g\n", val);
             else
                 fprintf(fp, "information matrix can't be factored\n");
 
-            if (grid) {
-                for (i = npop1 - 1; i >= 0; i--) {
+            if (grid)
+                done = !next_grid_point(m[iprp]);
+            else
+                done = 1;
+        }
+    }
+}
+
+/*
+ *  Compute the informativeness (determinant of the information matrix)
+ *  of a set of markers at admixture proportions m. Returns INF_OK, or
+ *  INF_UNDEF if the information is undefined, or INF_SINGULAR if the
+ *  information matrix can't be factored.
+ */
+
+int
+eval_inform (double *m, int ntst, int *mtst, double *val)
+{
+    int i, j, npop1;
+    int nose, job = 11;
+    double det[2];
+
+    npop1 = npop - 1;
+    for (i = 0; i < npop1; i++) {
+        for (j = 0; j < npop1; j++) {
+            info[i*npop1+j] = 0;
+        }
+    }
+
+    for (i = 0; i < ntst; i++) {
+        if (!marker_inform(mtst[i], m, info))
+            return INF_UNDEF;
+    }
+
+    dgefa_(info, &npop1, &npop1, ipvt, &nose);
+    if (nose)
+        return INF_SINGULAR;
+
+    dgedi_(info, &npop1, &npop1, ipvt, det, work, &job);
+    *val = det[0]*pow(10.,det[1]);
+
+    return INF_OK;
+}
+
+/*
+ *  Adaptive grid search. The informativeness is first computed on the
+ *  simplex lattice with spacing gridint. The lattice cells are then
+ *  subdivided, up to nref times, wherever the informativeness varies by
+ *  more than a fraction reftol of its overall range, comes within that
+ *  fraction of the smallest value found so far, or is undefined at some
+ *  but not all of the cell corners. Lattice points are kept in integer
+ *  units of the finest spacing, and each point is evaluated only once.
+ */
+
+void
+refine_inform (int ntst, int *mtst, FILE *fp)
+{
+    int i, j, k, d, npop1, ncorner;
+    int level, size, ncell, nnext, maxcell, nvalid, nin;
+    long limit, sum, *cell, *next, *c, p[MXPOP];
+    double lo, hi, gmin, gmax, *m;
+    struct Point *pt, *imin;
+
+    npop1 = npop - 1;
+    ncorner = 1 << npop1;
+    size = 1 << nref;
+    limit = (long) ((1 + TINY)/gridint)*size;
+    ptunit = (double) gridint/size;
+
+    m = (double *) allocMem(npop1*sizeof(double));
+
+    npoint = 0;
+    ptsize = 1024;
+    points = (struct Point *) allocMem(ptsize*sizeof(struct Point));
+    phsize = 2048;
+    phash = (int *) allocMem(phsize*sizeof(int));
+    for (i = 0; i < phsize; i++)
+        phash[i] = -1;
+
+    /* level 0 cells: one anchored at each point of the coarse lattice */
+    maxcell = 1024;
+    cell = (long *) allocMem(maxcell*npop1*sizeof(long));
+    ncell = 0;
+    for (i = 0; i < npop1; i++)
+        p[i] = 0;
+    do {
+        if (ncell == maxcell) {
+            maxcell *= 2;
+            cell = (long *) growMem(cell, maxcell*npop1*sizeof(long));
+        }
+        for (i = 0; i < npop1; i++)
+            cell[ncell*npop1+i] = p[i];
+        ncell++;
+        for (i = npop1 - 1; i >= 0; i--) {
+            sum = 0;
+            for (j = 0; j < npop1; j++)
+                if (j != i) sum += p[j];
+            p[i] += size;
+            if (p[i] + sum > limit)
+                p[i] = 0;
+            else
+                break;
+        }
+    } while (i != -1);
+
+    gmin = gmax = 0;
+    for (level = 0; ncell; level++) {
+        next = (long *) allocMem(ncell*ncorner*npop1*sizeof(long));
+        nnext = 0;
+
+        for (k = 0; k < ncell; k++) {
+            c = &cell[k*npop1];
+            nin = nvalid = 0;
+            for (d = 0; d < ncorner; d++) {
+                sum = 0;
+                for (i = 0; i < npop1; i++) {
+                    p[i] = c[i] + ((d >> i) & 1)*size;
+                    sum += p[i];
+                }
+                if (sum > limit) continue;
+                nin++;
+
+                pt = get_point(p, limit, ntst, mtst, m);
+                if (pt->status != INF_OK) continue;
+                if (!nvalid || pt->val < lo) lo = pt->val;
+                if (!nvalid || pt->val > hi) hi = pt->val;
+                nvalid++;
+            }
+
+            /* at level 0, only evaluate the coarse lattice */
+            if (!level || size == 1)
+                continue;
+
+            if ((nvalid && nvalid < nin) ||
+                (nvalid && (hi - lo > reftol*(gmax - gmin) ||
+                            lo <= gmin + reftol*(gmax - gmin))))
+            {
+                for (d = 0; d < ncorner; d++) {
                     sum = 0;
-                    for (j = 0; j < npop1; j++) {
-                        if (j != i)
-                            sum += m[iprp][j];
+                    for (i = 0; i < npop1; i++) {
+                        p[i] = c[i] + ((d >> i) & 1)*(size/2);
+                        sum += p[i];
                     }
-                    m[iprp][i] += gridint;
-                    if (m[iprp][i] > 1 + TINY - sum)
-                        m[iprp][i] = 0;
-                    else
-                        break;
+                    if (sum > limit) continue;
+                    for (i = 0; i < npop1; i++)
+                        next[nnext*npop1+i] = p[i];
+                    nnext++;
                 }
-                if (i == -1)
-                    done = 1;
             }
+        }
+
+        /* update the overall range of informativeness */
+        nvalid = 0;
+        for (i = 0; i < npoint; i++) {
+            if (points[i].status != INF_OK) continue;
+            if (!nvalid || points[i].val < gmin) gmin = points[i].val;
+            if (!nvalid || points[i].val > gmax) gmax = points[i].val;
+            nvalid++;
+        }
+
+        if (!level) {		/* start subdividing the level 0 cells */
+            free(next);
+            continue;
+        }
+
+        free(cell);
+        cell = next;
+        ncell = nnext;
+        size /= 2;
+    }
+    free(cell);
+
+    /* report all points in grid order, then the minimum */
+    qsort(points, npoint, sizeof(struct Point), cmp_point);
+
+    fprintf(fp, "Marker Set:");
+    if (ntst == nmrk)
+        fprintf(fp, " all markers\n");
+    else {
+        for (i = 0; i < ntst; i++)
+            fprintf(fp, " %s", mrk[mtst[i]].name);
+        fprintf(fp, "\n");
+    }
+    for (i = 1; i <= npop; i++)
+        fprintf(fp, "   M%d   ", i);
+    fprintf(fp, " INFORM\n");
+
+    imin = 0;
+    for (k = 0; k < npoint; k++) {
+        pt = &points[k];
+        print_point(pt, limit, fp);
+        if (pt->status == INF_UNDEF)
+            fprintf(fp, "********\n");
+        else if (pt->status == INF_OK) {
+            fprintf(fp, "%g\n", pt->val);
+            if (!imin || pt->val < imin->val)
+                imin = pt;
+        }
+        else
+            fprintf(fp, "information matrix can't be factored\n");
+    }
+
+    fprintf(fp, "Minimum: ");
+    if (imin) {
+        print_point(imin, limit, fp);
+        fprintf(fp, "%g\n", imin->val);
+    }
+    else
+        fprintf(fp, "none\n");
+
+    free(points);
+    free(phash);
+    free(m);
+}
+
+/*
+ *  Find a lattice point, given in integer units, evaluating the
+ *  informativeness there the first time the point is seen.
+ */
+
+struct Point *
+get_point (long *p, long limit, int ntst, int *mtst, double *m)
+{
+    int i, h, npop1;
+    unsigned long key;
+    struct Point *pt;
+
+    npop1 = npop - 1;
+    key = 0;
+    for (i = 0; i < npop1; i++)
+        key = key*(limit + 1) + p[i];
+
+    h = (int) ((key*2654435761u) & (phsize - 1));
+    while (phash[h] != -1) {
+        if (points[phash[h]].key == key)
+            return &points[phash[h]];
+        h = (h + 1) & (phsize - 1);
+    }
+
+    if (npoint == ptsize) {
+        ptsize *= 2;
+        points = (struct Point *) growMem(points, ptsize*sizeof(struct Point));
+    }
+    pt = &points[npoint];
+    pt->key = key;
+    for (i = 0; i < npop1; i++)
+        m[i] = p[i]*ptunit;
+    pt->status = eval_inform(m, ntst, mtst, &pt->val);
+    phash[h] = npoint++;
+
+    /* keep the hash table at most half full */
+    if (2*npoint > phsize) {
+        free(phash);
+        phsize *= 2;
+        phash = (int *) allocMem(phsize*sizeof(int));
+        for (h = 0; h < phsize; h++)
+            phash[h] = -1;
+        for (i = 0; i < npoint; i++) {
+            h = (int) ((points[i].key*2654435761u) & (phsize - 1));
+            while (phash[h] != -1)
+                h = (h + 1) & (phsize - 1);
+            phash[h] = i;
+        }
+    }
+
+    return pt;
+}
+
+void
+print_point (struct Point *pt, long limit, FILE *fp)
+{
+    int i, npop1;
+    unsigned long key;
+    long p[MXPOP];
+    double sum;
+
+    npop1 = npop - 1;
+    key = pt->key;
+    for (i = npop1 - 1; i >= 0; i--) {
+        p[i] = key%(limit + 1);
+        key /= limit + 1;
+    }
+
+    sum = 0;
+    for (i = 0; i < npop1; i++) {
+        fprintf(fp, "%7.5f ", p[i]*ptunit);
+        sum += p[i]*ptunit;
+    }
+    if (sum > 1) sum = 1;
+    fprintf(fp, "%7.5f ", 1 - sum);
+}
+
+int
+cmp_point (const void *a, const void *b)
+{
+    unsigned long ka = ((struct Point *) a)->key;
+    unsigned long kb = ((struct Point *) b)->key;
+
+    return (ka > kb) - (ka < kb);
+}
+
+/*
+ *  Add the contribution of marker i to the information matrix at
+ *  admixture proportions m. Returns 0 if the expected frequency of
+ *  some allele is too small for the information to be computed.
+ */
+
+int
+marker_inform (int i, double *m, double *minfo)
+{
+    int j, k, l;
+    int npop1 = npop - 1;
+    double denom, sum;
+
+    for (j = 0; j < mrk[i].nall; j++) {
+        sum = 0;
+        for (k = 0; k < npop; k++)
+            sum += mrk[i].afreq[k][j];
+        if (!sum) continue;
+
+        denom = mrk[i].afreq[npop1][j];
+        for (k = 0; k < npop1; k++) {
+            delta[k] = mrk[i].afreq[k][j] - mrk[i].afreq[npop1][j];
+            denom += m[k]*delta[k];
+        }
+        if (denom > TINY) {
+            for (k = 0; k < npop1; k++) {
+                for (l = 0; l < npop1; l++) {
+                    minfo[k*npop1+l] += 2*delta[k]*delta[l]/denom;
+                }
+            }
+        }
+        else
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+ *  Step to the next point in the grid of admixture proportions.
+ *  Returns 0 when the grid has been exhausted.
+ */
+
+int
+next_grid_point (double *m)
+{
+    int i, j;
+    int npop1 = npop - 1;
+    double sum;
+
+    for (i = npop1 - 1; i >= 0; i--) {
+        sum = 0;
+        for (j = 0; j < npop1; j++) {
+            if (j != i)
+                sum += m[j];
+        }
+        m[i] += gridint;
+        if (m[i] > 1 + TINY - sum)
+            m[i] = 0;
+        else
+            break;
+    }
+
+    return i != -1;
+}
+
+/*
+ *  Compute the informativeness of every window of wsize consecutive
+ *  markers, in locus file order, with window starts wstep markers apart.
+ *  The per-marker information matrices are accumulated into running
+ *  (prefix) sums, so that the matrix for any window is the difference
+ *  of two prefix sums and the whole scan is linear in the number of
+ *  markers at each admixture point.
+ */
+
+void
+scan_windows (int grid, int nprp, double *m[npop-1], FILE *fp)
+{
+    int i, j, k, w, npop1, nsq;
+    int iprp, done, nose, job = 11;
+    int *nbad;
+    double *psum, sum, det[2];
+
+    npop1 = npop - 1;
+    nsq = npop1*npop1;
+
+    psum = (double *) allocMem((nmrk+1)*nsq*sizeof(double));
+    nbad = (int *) allocMem((nmrk+1)*sizeof(int));
+
+    fprintf(fp, "Window Scan: %d markers, step %d\n", wsize, wstep);
+    for (i = 1; i <= npop; i++)
+        fprintf(fp, "  M%d  ", i);
+    fprintf(fp, " FIRST LAST INFORM\n");
+
+    if (grid) nprp = 1;
+    for (iprp = 0; iprp < nprp; iprp++) {
+        done = 0;
+        while (!done) {
+
+            /* prefix sums of per-marker information matrices, and of
+               the number of markers for which information is undefined */
+            for (k = 0; k < nsq; k++)
+                psum[k] = 0;
+            nbad[0] = 0;
+            for (i = 0; i < nmrk; i++) {
+                for (k = 0; k < nsq; k++)
+                    info[k] = 0;
+                nbad[i+1] = nbad[i];
+                if (!marker_inform(i, m[iprp], info))
+                    nbad[i+1]++;
+                for (k = 0; k < nsq; k++)
+                    psum[(i+1)*nsq+k] = psum[i*nsq+k] + info[k];
+            }
+
+            for (w = 0; w + wsize <= nmrk; w += wstep) {
+                sum = 0;
+                for (j = 0; j < npop1; j++) {
+                    fprintf(fp, "%5.3f ", m[iprp][j]);
+                    sum += m[iprp][j];
+                }
+                if (sum > 1) sum = 1;
+                fprintf(fp, "%5.3f ", 1 - sum);
+                fprintf(fp, "%s %s ", mrk[w].name, mrk[w+wsize-1].name);
+
+                if (nbad[w+wsize] - nbad[w]) {
+                    fprintf(fp, "********\n");
+                    continue;
+                }
+
+                for (k = 0; k < nsq; k++)
+                    info[k] = psum[(w+wsize)*nsq+k] - psum[w*nsq+k];
+                dgefa_(info, &npop1, &npop1, ipvt, &nose);
+                if (!nose) {
+                    dgedi_(info, &npop1, &npop1, ipvt, det, work, &job);
+                    fprintf(fp, "%g\n", det[0]*pow(10.,det[1]));
+                }
+                else
+                    fprintf(fp, "information matrix can't be factored\n");
+            }
+
+            if (grid)
+                done = !next_grid_point(m[iprp]);
             else
                 done = 1;
         }
     }
+
+    free(psum);
+    free(nbad);
 }
 
 void
 show_usage (char *prog)
 {
     printf(
-"usage: %s [-aq] [-p plist] [-m mlist] [-g gridint] [-o outfile] locfile [m1 ...]\n\n",
+"usage: %s [-aq] [-p plist] [-m mlist] [-g gridint] [-r nref [-t tol]]\n"
+"       [-w wsize [-s step]] [-o outfile] locfile [m1 ...]\n\n",
            prog);
     printf("   locfile      population-specific allele frequencies\n");
     printf("   m1 m2 ...    admixture proportions (optional)\n");
@@ -484,6 +970,10 @@ show_usage (char *prog)
     printf("     -m mlist     read sets of markers from file mlist\n");
     printf("     -a           use all markers simultaneously\n");
     printf("     -g gridint   grid interval\n");
+    printf("     -r nref      refine the grid adaptively up to nref times\n");
+    printf("     -t tol       grid refinement tolerance (default 0.05)\n");
+    printf("     -w wsize     scan windows of wsize consecutive markers\n");
+    printf("     -s step      # markers between window starts (default 1)\n");
     printf("     -o outfile   output file\n");
     printf("     -q           suppress warning messages\n");
     exit(1);
@@ -596,6 +1086,93 @@ read_locus_file (char *locfile, int nowarn)
     fclose(fp);
 }
 
+/*
+ *  Read one line of arbitrary length into a buffer which is grown as
+ *  needed. Returns 0 at end of file.
+ */
+
+int
+read_record (FILE *fp, char **buf, int *size)
+{
+    int len;
+
+    if (!*size) {
+        *size = 10000;
+        *buf = (char *) allocMem(*size);
+    }
+
+    len = 0;
+    while (fgets(*buf + len, *size - len, fp)) {
+        len += strlen(*buf + len);
+        if ((*buf)[len-1] == '\n')
+            break;
+        if (len == *size - 1) {
+            *size *= 2;
+            *buf = (char *) growMem(*buf, *size);
+        }
+    }
+
+    return len;
+}
+
+/*
+ *  Marker names are looked up through an open-addressing hash table
+ *  rather than a linear search of the marker list.
+ */
+
+void
+build_marker_index (void)
+{
+    int i, h;
+
+    nhash = 1;
+    while (nhash < 2*nmrk)
+        nhash *= 2;
+
+    mhash = (int *) allocMem(nhash*sizeof(int));
+    for (h = 0; h < nhash; h++)
+        mhash[h] = -1;
+
+    for (i = 0; i < nmrk; i++) {
+        h = hash_name(mrk[i].name) & (nhash - 1);
+        while (mhash[h] != -1) {
+            if (!strcmp(mrk[mhash[h]].name, mrk[i].name))
+                break;
+            h = (h + 1) & (nhash - 1);
+        }
+        if (mhash[h] == -1)	/* first occurrence of a name wins */
+            mhash[h] = i;
+    }
+}
+
+int
+find_marker (char *name)
+{
+    int h;
+
+    h = hash_name(name) & (nhash - 1);
+    while (mhash[h] != -1) {
+        if (!strcmp(mrk[mhash[h]].name, name))
+            return mhash[h];
+        h = (h + 1) & (nhash - 1);
+    }
+
+    return -1;
+}
+
+unsigned int
+hash_name (char *str)
+{
+    unsigned int h = 2166136261u;
+
+    while (*str) {
+        h ^= (unsigned char) *str++;
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
 int
 add_name (char *str, char ***array, int *nelem)
 {
@@ -637,3 +1214,14 @@ void
     }
     return ptr;
 }
+
+void
+*growMem (void *ptr, size_t nbytes)
+{
+    ptr = (void *) realloc(ptr, nbytes);
+    if (!ptr) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+    return ptr;
+}
@@ -10,9 +10,9 @@
  * of two markers among the set of markers in the allle frequencies file,
  * i.e. the first marker in the frequencies file is compared with the
  * second marker, the second marker is compared with the third marker,
- * the third marker with the fourth, and so on. If three or more markers
- * are specified, a test of 3-locus LD is also performed for each ordered
- * combination of three markers.
+ * the third marker with the fourth, and so on. With the -3 option, if
+ * three or more markers are specified, a test of 3-locus LD is also
+ * performed for each ordered combination of three markers.
  *
  * Note that if the allele frequencies file includes markers located on
  * more than one chromosome, LD tests will be made across chromosomal
@@ -23,17 +23,103 @@
  * markers will be compared in the order in which they occur in the list.
  *
  *
- * Usage:  ldtest [-m mlist] [-M missval] pedfile allfreq outfile
+ * Usage:  ldtest [-m mlist] [-M missval] [-w wsize] [-d maxdist]
+ *                [-t nthreads] [-B] [-3] [-e] [-r r2] [-p nperm]
+ *                [-L mbytes] pedfile allfreq outfile
  *
  *         pedfile      pedigree file (marker genotypes)
- *         allfreq      allele frequencies file
+ *         allfreq      allele frequencies file or binary count store
  *         outfile      output file
  *
  *         options:
  *           -m mlist     read markers to be tested from file mlist
  *           -M missval   missing allele value in quotes, e.g. "0"
+ *           -w wsize     test each marker with the next wsize markers
+ *           -d maxdist   test only markers at most maxdist apart
+ *           -t nthreads  number of threads used for the tests
+ *           -B           write D' as a binary band matrix
+ *           -3           also test 3-locus LD
+ *           -e           estimate haplotype frequencies by EM
+ *           -r r2        write the markers left by pruning at r2
+ *           -p nperm     add p-values from up to nperm permutations
+ *           -L mbytes    hold the genotypes in about mbytes MB of memory
  *
  *   The marker list file consists of marker names, one name per line.
+ *   A marker name may be followed by the position of the marker, e.g.
+ *   in base pairs, which is needed with the -d option.
+ *
+ *   By default, each marker is tested with the one following it in the
+ *   list. With the -w option, each marker is tested with each of the
+ *   wsize markers following it, and with the -d option, with each
+ *   following marker whose position is no more than maxdist from its
+ *   own. With both, a pair must be within both limits. The pairs of
+ *   each marker are listed in order, nearest first.
+ *
+ *   With the -3 option, each three consecutive markers of the list are
+ *   also tested. The 3-locus test uses the D of each pair of the three,
+ *   so the window is widened to at least 2 markers; a pair left out of
+ *   the window by the -d option is taken to have a D of 0. The -3 and -B
+ *   options cannot be used together.
+ *
+ *   By default, the phase of a genotype is taken as unknown, and each
+ *   individual adds every combination of an allele of one marker with an
+ *   allele of the other to the 2-locus haplotype counts. With the -e
+ *   option, the 2-locus haplotype frequencies are instead estimated by
+ *   the EM algorithm, from the individuals typed for both alleles at both
+ *   markers. The EM runs on the counts of each pair of genotypes, so its
+ *   cost does not depend on the number of individuals; for two markers
+ *   with two alleles each, the estimate is found directly as a root of a
+ *   cubic. The 3-locus tests are not affected by -e.
+ *
+ *   With the -r option, no tests are written. Instead, the list is pruned of
+ *   markers in LD, and the output file is a marker list of the names of the
+ *   markers kept, one per line, as read by ldtest -m and admix -m. inform -m
+ *   reads each line as a set of markers, so to evaluate the kept markers as
+ *   one set, join the names onto one line first, e.g. with tr '\n' ' '.
+ *   Walking down the list, each marker is kept unless its r2 with an earlier
+ *   marker that was kept, and in whose window it lies, is above r2. The
+ *   window is set by the -w and -d options, as for the tests. The r2 of a
+ *   pair is found in the total sample from haplotype frequencies estimated by
+ *   EM, as with -e; for markers with more than two alleles, it is the largest
+ *   D(i,j)^2/(p(i)(1-p(i))p(j)(1-p(j))) over the pairs of alleles i and j.
+ *   The list is the same for any number of threads. The -r option cannot be
+ *   used with -B or -3.
+ *
+ *   With the -p option, each statistic of a 2-locus test is also given an
+ *   empirical p-value, EMP-P, from permutations of the genotypes of the
+ *   second marker among the individuals of the stratum. The frequencies
+ *   and the statistic are found again for each permutation just as for the
+ *   observed genotypes, by EM with -e. The permutations stop once 20
+ *   permuted statistics are at least as large as each observed one, the
+ *   p-value then being 20 over the number of permutations, or else after
+ *   nperm permutations, when a statistic reached by r of them has p-value
+ *   (r+1)/(nperm+1). The p-values are the same for any number of threads.
+ *   The -p option cannot be used with -B or -r.
+ *
+ *   With the -L option, the genotypes are held in about mbytes megabytes of
+ *   memory. The limit bounds only the genotypes; the allele frequencies and
+ *   the terms of each marker's alleles used by the tests are held for all
+ *   markers, as without -L. The pedigree file is read in batches of
+ *   individuals, each written to its columns of a temporary file laid out
+ *   marker by marker, and the genotypes of each chunk of the test list and
+ *   the window after it are then read back from that file as the chunk is
+ *   tested. The output is the same as without -L, but the window must fit
+ *   within the limit.
+ *
+ *   With the -t option, the pairs (and triples) are tested by nthreads
+ *   threads in parallel. The output is the same for any number of
+ *   threads.
+ *
+ *   Pairs of markers with at most two alleles are counted from a bit
+ *   plane copy of their genotypes, using the vector popcount instructions
+ *   of the processor where available.
+ *
+ *   The genotypes of each pair are read once for all the strata. The
+ *   results of each stratum are held in a temporary file until the
+ *   stratum is written to the output file.
+ *
+ *   A binary count store, written by count -b, may be given in place
+ *   of the allele frequencies file.
  *
  *   The missing allele value is used in genotypes to denote an untyped
  *   allele. The default missing value is an asterisk (*).
@@ -80,14 +166,34 @@
  *   testing whether the disequilibrium differs significantly from zero,
  *   and 1 minus the p-value associated with that statistic.
  *
+ *   The p-values are computed in double precision, and are exact to
+ *   the printed digits even far out in the tail.
+ *
+ *   With the -B option, the output file holds only D' for each pair,
+ *   in binary. It begins with the 8 bytes "LDBAND1" and a NUL, then
+ *   the number of strata, the number of markers in the list, wsize, and
+ *   a zero, as 4-byte integers. Then follow wsize 4-byte floats for each
+ *   marker of the list in each stratum, D' of the marker with each of
+ *   the wsize markers after it, or NaN if that pair was not tested. The
+ *   strata are in the order of the text output: total sample,
+ *   unaffecteds, affecteds, and then all, unaffecteds and affecteds of
+ *   each population. Only 2-locus tests are done with this option.
+ *
  *
  */
 
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <math.h>
 
+#include "cntstore.h"
+#include "genomat.h"
+#include "bitgeno.h"
+#include "thrpool.h"
+#include "chisq.h"
+
 #define PHASE_UNKNOWN
 
 #define MXPOP	3	/* max # populations		*/
@@ -97,6 +203,19 @@
 
 #define ALLBLK  256	/* # array elements malloc'd at a time		*/
 
+#define MRKBLK	16	/* # markers per task when threaded		*/
+#define CHUNK	1024	/* max # markers whose results are held at a time */
+#define EM_MAXIT 1000	/* max # EM iterations				*/
+#define EM_TOL	1e-10	/* EM convergence tolerance			*/
+#define PERM_HITS 20	/* # permuted statistics at least as large as the
+			   observed one that resolve a p-value		*/
+#define PERM_TAB 4096	/* max size of the genotype pair table of a pair */
+#define PERM_SEED 0x4c44746573743a70	/* key of the random streams	*/
+
+#define NGENO(nall)	((nall)*((nall) + 1)/2)	/* # genotypes of a marker */
+
+#define BAND_MAGIC	"LDBAND1"
+
 
 struct Marker {
     char *name;		/* marker name			*/
@@ -114,11 +233,16 @@ double **afreqa;	/* allele freqs - affecteds	*/
 double ***afreqp;	/* allele freqs by population	*/
 double ***afreqpu;	/* freqs by pop - unaffecteds	*/
 double ***afreqpa;	/* freqs by pop - affecteds	*/
+double sfreq[3][MXPOP+1][MXALL]; /* freqs of the marker being read, by
+				   affection status and population+1 */
 
 int nind;		/* number of individuals	*/
 int *pop;		/* population			*/
 int *aff;		/* affection status		*/
-int **all1, **all2;	/* alleles at each marker	*/
+struct GenoMat geno;	/* alleles at each marker	*/
+struct BitGeno bgeno;	/* bit planes of biallelic mrks	*/
+int ncell;		/* # (population, affection) cells */
+int *cell;		/* cell of each individual	*/
 
 
 /*
@@ -135,34 +259,199 @@ char **famids;		/* family IDs			*/
 int nid = 0;		/* number of individual IDs	*/
 char **ids;		/* individual IDs		*/
 
+/*
+ *  The D values of a stratum are needed again only by the 3-locus
+ *  tests, so they are kept only with -3, and then only for the pairs of
+ *  a triple, (mtst[mm], mtst[mm+k]) for k = 1 and 2. The table of a pair
+ *  holds one value for each combination of the two markers' alleles,
+ *  D(i,j) at i*nall2 + j, and is allocated when the pair is tested.
+ *  The triples are tested chunk by chunk along with the pairs, so the
+ *  tables are kept in a ring of rows, one row for each marker from the
+ *  first triple not yet tested to the end of the current chunk, and
+ *  are freed once their triples are tested.
+ */
+
+struct DTable {
+    int wsize;		/* # pairs kept for each marker in the list	*/
+    int nrow;		/* # rows of the ring, a chunk and one more	*/
+    double **d;		/* table of pair (mm, mm+k) at row mm, k-1	*/
+} ;
+
+#define DT_PAIR(t, mm, k)	\
+	((t)->d[(size_t) ((mm) % (t)->nrow)*(t)->wsize + (k) - 1])
+
 int ntst, *mtst;
-double **pi, **tau, ****d2;
-double **piu, **tauu, ****d2u;
-double **pia, **taua, ****d2a;
-double ***pip, ***taup, *****d2p;
-double ***pipu, ***taupu, *****d2pu;
-double ***pipa, ***taupa, *****d2pa;
-double ***d3;
+double *mpos;		/* positions of the markers in the test list	*/
+
+int wsize = 1;		/* # following markers paired with each marker	*/
+double maxdist = 0;	/* max distance between paired markers		*/
+int nthread = 1;	/* number of threads				*/
+int band = 0;		/* write D' as a binary band matrix?		*/
+int triple = 0;		/* also test sliding triples of markers?	*/
+int phase_em = 0;	/* estimate haplotype frequencies by EM?	*/
+double prune_r2 = 0;	/* r2 above which markers are pruned, or 0	*/
+int nperm = 0;		/* max # permutations for empirical p-values	*/
+double memlimit = 0;	/* bytes for the genotypes with -L, or 0	*/
+int chunk = CHUNK;	/* # markers whose results are held at a time	*/
+
+/*
+ *  A stratum of the sample, i.e. the individuals in one population, or
+ *  in all, with one affection status, or with any, together with the
+ *  allele frequency, pi, tau and D tables of the stratum. A stratum is
+ *  a union of cells, each cell holding the individuals of one
+ *  population with one affection status.
+ */
+
+struct Stratum {
+    int ipop;		/* population, or -1 for all		*/
+    int iaff;		/* affection status, or 0 for all	*/
+    int n;		/* number of individuals		*/
+    char *indent;	/* indentation of output lines		*/
+    double **tafreq;
+    double **tpi;
+    double **ttau;
+    struct DTable *td2;
+    int ncell;		/* number of cells in stratum		*/
+    int *cells;		/* cells in stratum			*/
+    int *ind;		/* individuals in stratum		*/
+    FILE *tmp;		/* results, until written out		*/
+    FILE *tmp3;		/* 3-locus results, with -3		*/
+} ;
+
+/*
+ *  The strata in order of output: the total sample, unaffecteds and
+ *  affecteds, then the same three for each population.
+ */
+
+#define NSTRAT		(3 + 3*npop)
+#define STRATUM(ipop, iaff)	((ipop) == -1 ? (iaff) : 3 + 3*(ipop) + (iaff))
+
+struct Stratum *strata;
+
+/*
+ *  Growing text buffer, and the pairs (or triples) of one chunk of the
+ *  test list. The results of stratum s and marker mm of the chunk are in
+ *  slot s*chunk + mm-lo.
+ */
+
+struct Text {
+    char *buf;
+    size_t len;
+    size_t size;
+} ;
+
+struct PairJob {
+    int lo, hi;		/* chunk of the test list, lo <= mm < hi */
+    struct Text *out;	/* output text of each slot		*/
+    float *band;	/* D' of each pair of each slot		*/
+} ;
+
+/*
+ *  The pairs of one chunk of the test list when pruning. The r2 of pair
+ *  (mm, mm+w) is at (mm-lo)*wsize + w-1.
+ */
+
+struct PruneJob {
+    int lo, hi;		/* chunk of the test list, lo <= mm < hi */
+    struct Stratum *st;	/* total sample				*/
+    char *keep;		/* is each marker of the list kept?	*/
+    float *r2;		/* r2 of each pair of the chunk		*/
+} ;
+
+/*
+ *  Sparse counts of 3-locus haplotypes, or of 2-locus genotypes. A
+ *  haplotype is keyed by the ranks of its alleles in sorted order, so
+ *  that the keys of the non-zero counts sort into the order in which the
+ *  haplotypes are listed. Only the counts of the keys listed are
+ *  non-zero.
+ */
+
+struct HapTable {
+    int *cnt;		/* count of each key			*/
+    int *key;		/* keys of the non-zero counts		*/
+    int nkey;		/* number of non-zero counts		*/
+} ;
+
+double **pi, **tau;
+double **piu, **tauu;
+double **pia, **taua;
+double ***pip, ***taup;
+double ***pipu, ***taupu;
+double ***pipa, ***taupa;
+struct DTable d2, d2u, d2a, *d2p, *d2pu, *d2pa;
 
 
 void show_usage (char *);
 void read_allfreq_file (char *);
+void read_store (char *);
+void alloc_freqs (void);
+double **freq_table (int, int);
+void save_freqs (int);
 void read_pedigree_file (char *, char *);
-void do_2locus_tests (FILE *, int, int);
-void do_3locus_tests (FILE *, int, int);
-void setup_storage (double *****, double ***, double ***, double **);
+void open_strata (void);
+void do_2locus_tests (void);
+void write_stratum (FILE *, int, int);
+void pair_task (int, void *);
+int in_window (int, int);
+void count_cells (int, int, int (*)[2][MXALL], int (*)[MXALL][MXALL]);
+void sum_cells (struct Stratum *, int, int, int (*)[2][MXALL],
+                int (*)[MXALL][MXALL], int [2][MXALL], int [MXALL][MXALL]);
+void count_freqs (int, int, int [2][MXALL], int [MXALL][MXALL],
+                  double [2][MXALL], double [MXALL][MXALL]);
+void count_geno_cells (int, int, struct HapTable *);
+void em_freqs (int, int, struct HapTable *, double [2][MXALL],
+               double [MXALL][MXALL]);
+int em_cubic (double, double, double, int [MXALL][MXALL], int, double *);
+void geno_alleles (int, int *);
+double test_pair (struct Stratum *, int, int, double [2][MXALL],
+                  double [MXALL][MXALL], struct Text *);
+void perm_pvals (struct Stratum *, int, int, int, int *, int *, double *,
+                 double *);
+void add_perm_pair (int, int, int, int, int, int, int, int [2][MXALL],
+                    int [MXALL][MXALL], struct HapTable *);
+void shuffle (int *, int, uint64_t, uint64_t *);
+uint64_t ctr_rand (uint64_t, uint64_t);
+void set_stratum (struct Stratum *, int, int);
+void load_window (int, int);
+void prune_markers (FILE *);
+void prune_task (int, void *);
+double pair_r2 (int, int, double [2][MXALL], double [MXALL][MXALL]);
+void text_printf (struct Text *, char *, ...);
+void title (FILE *, char *, ...);
+void write_band_header (FILE *);
+void do_3locus_tests (struct PairJob *);
+void triple_task (int, void *);
+void count_triple (int, struct HapTable *);
+void test_triple (struct Stratum *, int, struct HapTable *, struct Text *);
+void ht_alloc (struct HapTable *, int);
+void ht_free (struct HapTable *);
+void ht_add (struct HapTable *, int, int);
+void ht_clear (struct HapTable *);
+int cmp_key (const void *, const void *);
+void setup_storage (struct DTable *, double ***, double ***, double **);
+double *dt_pair (struct DTable *, int, int);
+double dt_value (struct DTable *, int, int, int, int);
+void dt_release (struct DTable *, int, int);
+void dt_free (struct DTable *);
+void free_storage (void);
+int find_marker (char *);
+int cmp_mrkname (const void *, const void *);
+int read_record (FILE *, char **, int *);
 int get_ndx (char *, char **, int);
 int add_name (char *, char ***, int *);
+int add_allele (char *, char ***, int *);
 void sort_names(char **, int, int *);
 void *allocMem (size_t);
+void *growMem (void *, size_t);
 
 #define min(a,b)	((a) <= (b) ? (a) : (b))
 
 
 main (int argc, char **argv)
 {
-    int i, j, k, l;
-    int errflg = 0;
+    int i, j, k, l, mm, nslot, *brow;
+    int errflg = 0, wflag = 0, haspos = 1;
+    size_t size;
     char *mfile = 0;
     char missval[10] = "";
     char *recp, rec[10000];
@@ -171,11 +460,64 @@ main (int argc, char **argv)
     extern int optind, optopt;
 
     /* gather command line arguments */
-    while ((i = getopt(argc, argv, ":m:M:")) != -1) {
+    while ((i = getopt(argc, argv, ":m:M:w:d:t:B3er:p:L:")) != -1) {
         switch (i) {
         case 'm':
             mfile = optarg;
             break;
+        case 'w':
+            wsize = atoi(optarg);
+            wflag = 1;
+            if (wsize < 1) {
+                fprintf(stderr, "-w: window size must be positive\n");
+                exit(1);
+            }
+            break;
+        case 'd':
+            maxdist = atof(optarg);
+            if (maxdist <= 0) {
+                fprintf(stderr, "-d: distance must be positive\n");
+                exit(1);
+            }
+            break;
+        case 't':
+            nthread = atoi(optarg);
+            if (nthread < 1) {
+                fprintf(stderr, "-t: number of threads must be positive\n");
+                exit(1);
+            }
+            break;
+        case 'B':
+            band = 1;
+            break;
+        case '3':
+            triple = 1;
+            break;
+        case 'e':
+            phase_em = 1;
+            break;
+        case 'r':
+            prune_r2 = atof(optarg);
+            if (prune_r2 <= 0 || prune_r2 > 1) {
+                fprintf(stderr, "-r: r2 must be greater than 0 and at most 1\n");
+                exit(1);
+            }
+            break;
+        case 'p':
+            nperm = atoi(optarg);
+            if (nperm < 1) {
+                fprintf(stderr,
+                        "-p: number of permutations must be positive\n");
+                exit(1);
+            }
+            break;
+        case 'L':
+            memlimit = atof(optarg)*1024*1024;
+            if (memlimit <= 0) {
+                fprintf(stderr, "-L: memory limit must be positive\n");
+                exit(1);
+            }
+            break;
         case 'M':
             strncpy(missval, optarg, sizeof(missval)-1);
             missval[sizeof(missval)-1] = 0;
@@ -194,21 +536,43 @@ main (int argc, char **argv)
         show_usage(argv[0]);
     }
 
+    if (triple && band) {
+        fprintf(stderr, "-3 cannot be used with -B\n");
+        exit(1);
+    }
+    if (prune_r2 && (band || triple || nperm)) {
+        fprintf(stderr, "-r cannot be used with -B, -3 or -p\n");
+        exit(1);
+    }
+    if (nperm && band) {
+        fprintf(stderr, "-p cannot be used with -B\n");
+        exit(1);
+    }
+    if (triple && wflag && wsize < 2) {
+        fprintf(stderr, "-3: window size must be at least 2\n");
+        exit(1);
+    }
+
     if (!strlen(missval)) {
         strncpy(missval, MISSVAL, sizeof(missval)-1);
         missval[sizeof(missval)-1] = 0;
     }
 
-    read_allfreq_file(argv[optind+1]);
+    if (cs_is_store(argv[optind+1]))
+        read_store(argv[optind+1]);
+    else
+        read_allfreq_file(argv[optind+1]);
 
 
     /* set up list of markers to be tested */
     mtst = (int *) allocMem(nmrk*sizeof(int));
+    mpos = (double *) allocMem(nmrk*sizeof(double));
     if (!mfile) {
         for (i = 0; i < nmrk; i++) {
             mtst[i] = i;
         }
         ntst = nmrk;
+        haspos = 0;
     }
     else {
         fp = fopen(mfile, "r");
@@ -219,19 +583,21 @@ main (int argc, char **argv)
 
         ntst = 0;
         while (fgets(rec, sizeof(rec), fp)) {
-            recp = strtok(rec, "\n");
-            mtst[ntst] = -1;
-            for (j = 0; j < nmrk; j++) {
-                if (!strcmp(recp, mrk[j].name)) {
-                    mtst[ntst] = j;
-                    break;
-                }
+            if (!(recp = strtok(rec, " \t\n")))
+                continue;
+            if (ntst == nmrk) {
+                fprintf(stderr, "marker list has more markers than frequencies file\n");
+                exit(1);
             }
-            if (mtst[ntst] == -1) {
+            if ((mtst[ntst] = find_marker(recp)) == -1) {
                 fprintf(stderr, "marker %s not found in frequencies file\n",
                         recp);
                 exit(1);
             }
+            if ((recp = strtok(NULL, " \t\n")))
+                mpos[ntst] = atof(recp);
+            else
+                haspos = 0;
             ntst++;
         }
 
@@ -248,42 +614,110 @@ main (int argc, char **argv)
         exit(1);
     }
 
+    /* with only a distance, the window is as wide as that distance spans */
+    if (maxdist) {
+        if (!haspos) {
+            fprintf(stderr,
+                    "-d: marker list must give a position for every marker\n");
+            exit(1);
+        }
+        if (!wflag) {
+            wsize = 1;
+            for (i = 0; i < ntst; i++) {
+                for (j = i + 1; j < ntst
+                        && fabs(mpos[j] - mpos[i]) <= maxdist; j++) ;
+                if (j - i - 1 > wsize)
+                    wsize = j - i - 1;
+            }
+        }
+    }
+    /* the 3-locus tests need D for the outer pair of each triple */
+    if (triple && wsize < 2)
+        wsize = 2;
+    if (wsize > ntst - 1)
+        wsize = ntst - 1;
+
     read_pedigree_file(argv[optind], missval);
 
+    /* biallelic markers are also held as bit planes, by cell */
+    ncell = 2*npop;
+    cell = (int *) allocMem(nind*sizeof(int));
+    for (i = 0; i < nind; i++)
+        cell[i] = 2*pop[i] + aff[i] - 1;
+
+    if (memlimit) {
+        /* with -L, only the markers of one chunk of the test list and
+           its window, and with -3 the marker before the chunk, are held,
+           in both forms, within the limit */
+        size = 2*(((size_t) nind + 63) & ~(size_t) 63)
+               + 8*GB_NPLANE*((size_t) nind/64 + ncell);
+        chunk = min(CHUNK, memlimit/size - wsize - triple);
+        if (chunk < 1) {
+            fprintf(stderr,
+                    "-L: memory limit too small for a window of %d markers\n",
+                    wsize);
+            exit(1);
+        }
+        nslot = chunk + wsize + triple;
+        gm_spill_done(&geno, nslot);
+        gb_alloc(&bgeno, nslot, nind, ncell, cell);
+        bgeno.row = geno.row;
+    }
+    else {
+        /* planes are held only for the biallelic markers of the list */
+        brow = (int *) allocMem(nmrk*sizeof(int));
+        for (i = 0; i < nmrk; i++)
+            brow[i] = -1;
+        for (j = 0, mm = 0; mm < ntst; mm++) {
+            if (mrk[mtst[mm]].nall <= 2 && brow[mtst[mm]] == -1)
+                brow[mtst[mm]] = j++;
+        }
+        gb_alloc(&bgeno, j, nind, ncell, cell);
+        bgeno.row = brow;
+        for (i = 0; i < nmrk; i++) {
+            if (brow[i] != -1)
+                gb_set_marker(&bgeno, i, GM_ALL1(&geno, i), GM_ALL2(&geno, i));
+        }
+    }
+
+    /* with -r, only the pruned list of markers is written */
+    if (prune_r2) {
+        fp = fopen(argv[optind+2], "w");
+        if (!fp) {
+            fprintf(stderr, "cannot open output file %s\n", argv[optind+2]);
+            exit(1);
+        }
+        prune_markers(fp);
+        fclose(fp);
+        exit(0);
+    }
+
     /* allocate and initialize storage */
     setup_storage(&d2, &pi, &tau, afreq);
     setup_storage(&d2u, &piu, &tauu, afrequ);
     setup_storage(&d2a, &pia, &taua, afreqa);
 
-    d2p = (double *****) allocMem(npop*sizeof(double ****));
+    d2p = (struct DTable *) allocMem(npop*sizeof(struct DTable));
     pip = (double ***) allocMem(npop*sizeof(double **));
     taup = (double ***) allocMem(npop*sizeof(double **));
     for (i = 0; i < npop; i++) {
         setup_storage(&d2p[i], &pip[i], &taup[i], afreqp[i]);
     }
 
-    d2pu = (double *****) allocMem(npop*sizeof(double ****));
+    d2pu = (struct DTable *) allocMem(npop*sizeof(struct DTable));
     pipu = (double ***) allocMem(npop*sizeof(double **));
     taupu = (double ***) allocMem(npop*sizeof(double **));
     for (i = 0; i < npop; i++) {
         setup_storage(&d2pu[i], &pipu[i], &taupu[i], afreqpu[i]);
     }
 
-    d2pa = (double *****) allocMem(npop*sizeof(double ****));
+    d2pa = (struct DTable *) allocMem(npop*sizeof(struct DTable));
     pipa = (double ***) allocMem(npop*sizeof(double **));
     taupa = (double ***) allocMem(npop*sizeof(double **));
     for (i = 0; i < npop; i++) {
         setup_storage(&d2pa[i], &pipa[i], &taupa[i], afreqpa[i]);
     }
 
-    d3 = (double ***) allocMem(nmrk*sizeof(double **));
-    for (i = 0; i < MXALL; i++) {
-        d3[i] = (double **) allocMem(MXALL*sizeof(double *));
-        for (j = 0; j < MXALL; j++) {
-            d3[i][j] = (double *) allocMem(MXALL*sizeof(double));
-        }
-    }
-
     fp = fopen(argv[optind+2], "w");
     if (!fp) {
         fprintf(stderr, "cannot open output file %s\n", argv[optind+2]);
@@ -291,71 +725,90 @@ main (int argc, char **argv)
     }
 
 /*
- *  Perform LD test for all pairs of adjacent markers specified in
- *  the marker list file.
+ *  Perform LD test for all pairs of markers within the window of each
+ *  other, in the order given in the marker list file.
  */
 
-    fprintf(fp, "2-LOCUS LD TESTS\n");
-    fprintf(fp, "================\n\n");
-    fprintf(fp, "TOTAL SAMPLE");
-    do_2locus_tests(fp, -1, 0);
-    fprintf(fp, "\nUNAFFECTED");
-    do_2locus_tests(fp, -1, 1);
-    fprintf(fp, "\nAFFECTED");
-    do_2locus_tests(fp, -1, 2);
+    if (band)
+        write_band_header(fp);
+    title(fp, "2-LOCUS LD TESTS\n");
+    title(fp, "================\n\n");
+    do_2locus_tests();
+    title(fp, "TOTAL SAMPLE");
+    write_stratum(fp, -1, 0);
+    title(fp, "\nUNAFFECTED");
+    write_stratum(fp, -1, 1);
+    title(fp, "\nAFFECTED");
+    write_stratum(fp, -1, 2);
 
     for (i = 0; i < npop; i++) {
-        fprintf(fp, "\nPOPULATION: %s\n", pops[i]);
-        fprintf(fp, "\n   ALL");
-        do_2locus_tests(fp, i, 0);
-        fprintf(fp, "\n   UNAFFECTED", pops[i]);
-        do_2locus_tests(fp, i, 1);
-        fprintf(fp, "\n   AFFECTED", pops[i]);
-        do_2locus_tests(fp, i, 2);
+        title(fp, "\nPOPULATION: %s\n", pops[i]);
+        title(fp, "\n   ALL");
+        write_stratum(fp, i, 0);
+        title(fp, "\n   UNAFFECTED");
+        write_stratum(fp, i, 1);
+        title(fp, "\n   AFFECTED");
+        write_stratum(fp, i, 2);
     }
 
-    if (ntst == 2) {
+    if (!triple || ntst == 2) {
         fclose(fp);
+        free_storage();
         exit(0);
     }
 
 /*
- *  Perform LD test for the set of markers in a 3-marker "sliding window"
- *  moving from the beginning to the end of the list of markers.
+ *  Write the LD tests for the set of markers in a 3-marker "sliding
+ *  window" moving from the beginning to the end of the list of markers,
+ *  which were run along with the 2-locus tests.
  */
-/*
+
+    for (i = 0; i < NSTRAT; i++)
+        strata[i].tmp = strata[i].tmp3;
     fprintf(fp, "\n\n3-LOCUS LD TESTS\n");
     fprintf(fp, "================\n\n");
     fprintf(fp, "TOTAL SAMPLE");
-    do_3locus_tests(fp, -1, 0);
+    write_stratum(fp, -1, 0);
     fprintf(fp, "\nUNAFFECTED");
-    do_3locus_tests(fp, -1, 1);
+    write_stratum(fp, -1, 1);
     fprintf(fp, "\nAFFECTED");
-    do_3locus_tests(fp, -1, 2);
+    write_stratum(fp, -1, 2);
 
     for (i = 0; i < npop; i++) {
         fprintf(fp, "\nPOPULATION: %s\n", pops[i]);
         fprintf(fp, "\n   ALL");
-        do_3locus_tests(fp, i, 0);
-        fprintf(fp, "\n   UNAFFECTED", pops[i]);
-        do_3locus_tests(fp, i, 1);
-        fprintf(fp, "\n   AFFECTED", pops[i]);
-        do_3locus_tests(fp, i, 2);
+        write_stratum(fp, i, 0);
+        fprintf(fp, "\n   UNAFFECTED");
+        write_stratum(fp, i, 1);
+        fprintf(fp, "\n   AFFECTED");
+        write_stratum(fp, i, 2);
     }
-*/
+
     fclose(fp);
+    free_storage();
 }
 
 void
 show_usage (char *prog)
 {
-    printf("usage: %s [-m mlist] [-M missval] pedfile allfreq outfile\n\n", prog);
+    printf("usage: %s [-m mlist] [-M missval] [-w wsize] [-d maxdist]\n", prog);
+    printf("          [-t nthreads] [-B] [-3] [-e] [-r r2] [-p nperm]\n");
+    printf("          [-L mbytes] pedfile allfreq outfile\n\n");
     printf("   pedfile      pedigree file\n");
     printf("   allfreq      allele frequencies file\n");
     printf("   outfile      output file\n");
     printf("\n   options:\n");
     printf("     -m mlist     read sets of markers from file mlist\n");
     printf("     -M missval   missing allele value in quotes\n");
+    printf("     -w wsize     test each marker with the next wsize markers\n");
+    printf("     -d maxdist   test only markers at most maxdist apart\n");
+    printf("     -t nthreads  number of threads\n");
+    printf("     -B           write D' as a binary band matrix\n");
+    printf("     -3           also test 3-locus LD\n");
+    printf("     -e           estimate haplotype frequencies by EM\n");
+    printf("     -r r2        write the markers left by pruning at r2\n");
+    printf("     -p nperm     add p-values from up to nperm permutations\n");
+    printf("     -L mbytes    hold the genotypes in about mbytes MB of memory\n");
     exit(1);
 }
 
@@ -388,40 +841,7 @@ void read_allfreq_file (char *frqfile)
         }
     }
 
-    mrk = (struct Marker *) allocMem(nmrk*sizeof(struct Marker));
-
-    afreq = (double **) allocMem(nmrk*sizeof(double *));
-    for (imrk = 0; imrk < nmrk; imrk++)
-        afreq[imrk] = (double *) allocMem(MXALL*sizeof(double));
-
-    afrequ = (double **) allocMem(nmrk*sizeof(double *));
-    for (imrk = 0; imrk < nmrk; imrk++)
-        afrequ[imrk] = (double *) allocMem(MXALL*sizeof(double));
-
-    afreqa = (double **) allocMem(nmrk*sizeof(double *));
-    for (imrk = 0; imrk < nmrk; imrk++)
-        afreqa[imrk] = (double *) allocMem(MXALL*sizeof(double));
-
-    afreqp = (double ***) allocMem(MXPOP*sizeof(double **));
-    for (ipop = 0; ipop < MXPOP; ipop++) {
-        afreqp[ipop] = (double **) allocMem(nmrk*sizeof(double *));
-        for (imrk = 0; imrk < nmrk; imrk++)
-            afreqp[ipop][imrk] = (double *) allocMem(MXALL*sizeof(double));
-    }
-
-    afreqpu = (double ***) allocMem(MXPOP*sizeof(double **));
-    for (ipop = 0; ipop < MXPOP; ipop++) {
-        afreqpu[ipop] = (double **) allocMem(nmrk*sizeof(double *));
-        for (imrk = 0; imrk < nmrk; imrk++)
-            afreqpu[ipop][imrk] = (double *) allocMem(MXALL*sizeof(double));
-    }
-
-    afreqpa = (double ***) allocMem(MXPOP*sizeof(double **));
-    for (ipop = 0; ipop < MXPOP; ipop++) {
-        afreqpa[ipop] = (double **) allocMem(nmrk*sizeof(double *));
-        for (imrk = 0; imrk < nmrk; imrk++)
-            afreqpa[ipop][imrk] = (double *) allocMem(MXALL*sizeof(double));
-    }
+    alloc_freqs();
 
     rewind(fp);
     imrk = -1;
@@ -435,6 +855,8 @@ void read_allfreq_file (char *frqfile)
             exit(1);
         }
         if (strcmp(recp, currmrk)) {
+            if (imrk >= 0)
+                save_freqs(imrk);
             imrk++;
             mrk[imrk].name = (char *) allocMem(strlen(recp)+1);
             sscanf(rec, "%s", mrk[imrk].name);
@@ -475,8 +897,14 @@ void read_allfreq_file (char *frqfile)
                     line);
             exit(1);
         }
-        if ((iall = get_ndx(recp, mrk[imrk].alleles, mrk[imrk].nall)) == -1)
-            iall = add_name(recp, &mrk[imrk].alleles, &mrk[imrk].nall);
+        if ((iall = get_ndx(recp, mrk[imrk].alleles, mrk[imrk].nall)) == -1) {
+            if (mrk[imrk].nall == MXALL) {
+                fprintf(stderr, "marker %s has too many alleles, MXALL = %d\n",
+                        mrk[imrk].name, MXALL);
+                exit(1);
+            }
+            iall = add_allele(recp, &mrk[imrk].alleles, &mrk[imrk].nall);
+        }
 
         if (!(recp = strtok(NULL, " \t\n"))) {
             fprintf(stderr, "%s: missing allele count, line %d\n", frqfile, line);
@@ -488,25 +916,16 @@ void read_allfreq_file (char *frqfile)
                     line);
             exit(1);
         }
-        if (ipop == -1) {
-            if (iaff == 0)
-                afreq[imrk][iall] = atof(recp);
-            else if (iaff == 1)
-                afrequ[imrk][iall] = atof(recp);
-            else if (iaff == 2)
-                afreqa[imrk][iall] = atof(recp);
-        }
-        else {
-            if (iaff == 0)
-                afreqp[ipop][imrk][iall] = atof(recp);
-            else if (iaff == 1)
-                afreqpu[ipop][imrk][iall] = atof(recp);
-            else if (iaff == 2)
-                afreqpa[ipop][imrk][iall] = atof(recp);
-        }
+        sfreq[iaff][ipop+1][iall] = atof(recp);
 
     }
 
+    /* populations first seen after a marker have frequency zero there */
+    if (imrk >= 0)
+        save_freqs(imrk);
+    for (i = 0; i < nmrk; i++)
+        save_freqs(i);
+
     for (i = 0; i < nmrk; i++) {
         mrk[i].all_sort = (int *) allocMem(mrk[i].nall*sizeof(int));
         sort_names(mrk[i].alleles, mrk[i].nall, mrk[i].all_sort);
@@ -517,9 +936,9 @@ void read_allfreq_file (char *frqfile)
 
 void read_pedigree_file (char *pedfile, char *missval)
 {
-    int i, j, k, l, line;
+    int i, j, k, l, a, line, recsz = 0;
     int famid, id, sex;
-    char *recp, rec[10000];
+    char *recp, *rec;
     FILE *fp;
 
     fp = fopen(pedfile, "r");
@@ -529,24 +948,22 @@ void read_pedigree_file (char *pedfile, char *missval)
     }
 
     nind = 0;
-    while (fgets(rec, sizeof(rec), fp)) {
+    while (read_record(fp, &rec, &recsz)) {
         nind++;
     }
 
     pop = (int *) allocMem(nind*sizeof(int));
     aff = (int *) allocMem(nind*sizeof(int));
 
-    all1 = (int **) allocMem(nind*sizeof(int *));
-    all2 = (int **) allocMem(nind*sizeof(int *));
-    for (i = 0; i < nind; i++) {
-        all1[i] = (int *) allocMem(nmrk*sizeof(int));
-        all2[i] = (int *) allocMem(nmrk*sizeof(int));
-    }
+    if (memlimit)
+        gm_spill(&geno, nmrk, nind, memlimit);
+    else
+        gm_alloc(&geno, nmrk, nind);
 
     rewind(fp);
     i = 0;
     line = 0;
-    while (fgets(rec, sizeof(rec), fp)) {
+    while (read_record(fp, &rec, &recsz)) {
         line++;
 
         if (!(recp = strtok(rec, " \t\n"))) {
@@ -607,6 +1024,8 @@ void read_pedigree_file (char *pedfile, char *missval)
         }
 
         /* read in the marker alleles */
+        if (memlimit)
+            gm_stage(&geno, i);
         for (j = 0; j < nmrk; j++) {
             if (!(recp = strtok(NULL, " \t\n")))
             {
@@ -616,10 +1035,13 @@ void read_pedigree_file (char *pedfile, char *missval)
             }
             if (!strcmp(recp, missval))
             {
-                all1[i][j] = -1;
+                GM_ALL1(&geno, j)[i] = GM_MISSING;
+            }
+            else if ((a = get_ndx(recp, mrk[j].alleles, mrk[j].nall)) != -1)
+            {
+                GM_ALL1(&geno, j)[i] = a;
             }
-            else if ((all1[i][j] =
-                 get_ndx(recp, mrk[j].alleles, mrk[j].nall)) == -1)
+            else
             {
                 fprintf(stderr, "%s: unknown allele %s, marker %s, line %d\n",
                         pedfile, recp, mrk[j].name, line);
@@ -634,10 +1056,13 @@ void read_pedigree_file (char *pedfile, char *missval)
             }
             if (!strcmp(recp, missval))
             {
-                all2[i][j] = -1;
+                GM_ALL2(&geno, j)[i] = GM_MISSING;
             }
-            else if ((all2[i][j] =
-                 get_ndx(recp, mrk[j].alleles, mrk[j].nall)) == -1)
+            else if ((a = get_ndx(recp, mrk[j].alleles, mrk[j].nall)) != -1)
+            {
+                GM_ALL2(&geno, j)[i] = a;
+            }
+            else
             {
                 fprintf(stderr, "%s: unknown allele %s, marker %s, line %d\n",
                         pedfile, recp, mrk[j].name, line);
@@ -655,432 +1080,1872 @@ void read_pedigree_file (char *pedfile, char *missval)
     }
 
     fclose(fp);
+    free(rec);
 }
 
-void do_2locus_tests (FILE *fp, int ipop, int iaff)
+/*
+ *  Test the pairs of markers in the window of each marker of the test
+ *  list, in every stratum. The pairs of each block of MRKBLK markers are
+ *  tested by one task, so that blocks may be run in parallel, and the
+ *  results of every marker go to their own slot. The genotypes of each
+ *  pair are read once, into counts for each cell, and the counts of a
+ *  stratum are the sums over its cells. The results are held for chunk
+ *  markers at a time and are then appended, in list order, to a
+ *  temporary file for each stratum, so the output does not depend on
+ *  the number of threads. With -3, the triples whose pairs have all been
+ *  tested are then tested too, and the D tables they used are freed.
+ */
+
+void do_2locus_tests (void)
 {
-    int i, j, ii, jj, n, nfrq;
-    int m1, m2, mm1, mm2;
-    int acnt[2][MXALL];
-    int hcnt2[MXALL][MXALL];
-    double afrq[2][MXALL];
-    double hfrq2[MXALL][MXALL];
-    double ****td2, **tafreq, **tpi;
-    double freq, sum, asum;
-    double dmax, dprime;
-    double chi, var, df = 1, pchis_();
-    char buf[10], indent[10];
+    int s, mm, lo, hi, tlo, nslot;
+    struct PairJob job, job3;
+
+    strata = (struct Stratum *) allocMem(NSTRAT*sizeof(struct Stratum));
+    for (s = 0; s < NSTRAT; s++)
+        set_stratum(&strata[s], s < 3 ? -1 : (s - 3)/3, s%3);
+    open_strata();
+
+    nslot = NSTRAT*chunk;
+    job.out = (struct Text *) allocMem(nslot*sizeof(struct Text));
+    job.band = (float *) allocMem(nslot*wsize*sizeof(float));
+    if (triple) {
+        job3.out = (struct Text *) allocMem(nslot*sizeof(struct Text));
+        job3.band = 0;
+    }
 
-    if (ipop == -1) {
-        if (iaff == 1) {
-            tafreq = afrequ;
-            tpi = piu;
-            td2 = d2u;
+    tlo = 0;
+    for (lo = 0; lo < ntst; lo += chunk) {
+        hi = min(lo + chunk, ntst);
+        load_window(triple ? tlo : lo, min(hi + wsize, ntst));
+        job.lo = lo;
+        job.hi = hi;
+        for (mm = 0; mm < nslot; mm++) {
+            job.out[mm].buf = 0;
+            job.out[mm].len = job.out[mm].size = 0;
         }
-        else if (iaff == 2) {
-            tafreq = afreqa;
-            tpi = pia;
-            td2 = d2a;
+        for (mm = 0; mm < nslot*wsize; mm++)
+            job.band[mm] = NAN;
+
+        run_tasks(nthread, (hi - lo + MRKBLK - 1)/MRKBLK, pair_task, &job);
+
+        for (s = 0; s < NSTRAT; s++) {
+            if (band)
+                fwrite(job.band + s*chunk*wsize, sizeof(float),
+                       (hi - lo)*wsize, strata[s].tmp);
+            for (mm = s*chunk; mm < s*chunk + hi - lo; mm++) {
+                if (job.out[mm].len)
+                    fwrite(job.out[mm].buf, 1, job.out[mm].len,
+                           strata[s].tmp);
+                free(job.out[mm].buf);
+            }
         }
-        else {
-            tafreq = afreq;
-            tpi = pi;
-            td2 = d2;
+
+        /* triple mm needs the pairs of markers mm and mm+1 */
+        if (triple && min(hi - 1, ntst - 2) > tlo) {
+            job3.lo = tlo;
+            job3.hi = min(hi - 1, ntst - 2);
+            do_3locus_tests(&job3);
+            for (s = 0; s < NSTRAT; s++)
+                dt_release(strata[s].td2, job3.lo, job3.hi);
+            tlo = job3.hi;
         }
-        strcpy(indent, "   ");
     }
-    else {
-        if (iaff == 1) {
-            tafreq = afreqpu[ipop];
-            tpi = pipu[ipop];
-            td2 = d2pu[ipop];
-        }
-        else if (iaff == 2) {
-            tafreq = afreqpa[ipop];
-            tpi = pipa[ipop];
-            td2 = d2pa[ipop];
-        }
-        else {
-            tafreq = afreqp[ipop];
-            tpi = pip[ipop];
-            td2 = d2p[ipop];
+
+    free(job.out);
+    free(job.band);
+    if (triple)
+        free(job3.out);
+}
+
+/*
+ *  Open a temporary file for the results of each stratum, and with -3
+ *  another for its 3-locus results.
+ */
+
+void open_strata (void)
+{
+    int s;
+
+    for (s = 0; s < NSTRAT; s++) {
+        strata[s].tmp3 = 0;
+        if (!(strata[s].tmp = tmpfile())
+                || (triple && !(strata[s].tmp3 = tmpfile()))) {
+            fprintf(stderr, "cannot create temporary file\n");
+            exit(1);
         }
-        strcpy(indent, "      ");
     }
+}
 
-    n = 0;
-    for (i = 0; i < nind; i++) {
-        if (ipop != -1 && pop[i] != ipop)
-            continue;
-        if (iaff != 0 && aff[i] != iaff)
-            continue;
-        n++;
-    }
-    fprintf(fp, "  (N = %d)\n", n);
+/*
+ *  Write the results of the tests of a stratum.
+ */
 
-    if (!n) return;	/* empty subgroup, so nothing to do	*/
+void write_stratum (FILE *fp, int ipop, int iaff)
+{
+    struct Stratum *st = &strata[STRATUM(ipop, iaff)];
+    char buf[BUFSIZ];
+    size_t n;
+
+    if (!band)
+        fprintf(fp, "  (N = %d)\n", st->n);
+
+    rewind(st->tmp);
+    while ((n = fread(buf, 1, sizeof(buf), st->tmp)) > 0)
+        fwrite(buf, 1, n, fp);
+    if (ferror(st->tmp)) {
+        fprintf(stderr, "error reading temporary file\n");
+        exit(1);
+    }
+    fclose(st->tmp);
+    st->tmp = 0;
+}
 
-    /* test pairs of adjacent markers */
-    for (mm1 = 0; mm1 < ntst - 1; mm1++) {
-        for (mm2 = mm1 + 1; mm2 < mm1 + 2; mm2++) {
-            m1 = mtst[mm1];
-            m2 = mtst[mm2];
+/*
+ *  Test the pairs of block k of MRKBLK markers of a chunk, in each
+ *  stratum. An empty stratum has nothing to test.
+ */
 
-            for (i = 0; i < MXALL; i++) {
-                acnt[0][i] = acnt[1][i] = 0;
-                afrq[0][i] = afrq[1][i] = 0;
-                for (j = 0; j < MXALL; j++) {
-                    hcnt2[i][j] = 0;
-                    hfrq2[i][j] = 0;
-                }
+void pair_task (int k, void *arg)
+{
+    struct PairJob *job = (struct PairJob *) arg;
+    int mm, w, s, c, i, slot, last, size, maxsize;
+    int (*cacnt)[2][MXALL], (*chcnt)[MXALL][MXALL];
+    int acnt[2][MXALL], hcnt2[MXALL][MXALL];
+    double afrq[2][MXALL], hfrq2[MXALL][MXALL];
+    struct HapTable *ht = 0, *cht, *sht = 0;
+
+    cacnt = 0;
+    chcnt = 0;
+    last = min(job->lo + (k + 1)*MRKBLK, job->hi);
+
+    if (phase_em) {
+        /* one genotype table for each cell, and one for the stratum */
+        maxsize = 0;
+        for (mm = job->lo + k*MRKBLK; mm < last; mm++) {
+            for (w = 1; w <= wsize && mm + w < ntst; w++) {
+                size = NGENO(mrk[mtst[mm]].nall)*NGENO(mrk[mtst[mm+w]].nall);
+                if (size > maxsize)
+                    maxsize = size;
             }
+        }
+        ht = (struct HapTable *) allocMem((ncell + 1)*sizeof(struct HapTable));
+        for (c = 0; c <= ncell; c++)
+            ht_alloc(&ht[c], maxsize);
+        sht = &ht[ncell];
+    }
+    else {
+        cacnt = (int (*)[2][MXALL]) allocMem(ncell*sizeof(*cacnt));
+        chcnt = (int (*)[MXALL][MXALL]) allocMem(ncell*sizeof(*chcnt));
+    }
 
-            for (i = 0; i < nind; i++) {
-                if (ipop != -1 && pop[i] != ipop)
-                    continue;
-                if (iaff != 0 && aff[i] != iaff)
+    for (mm = job->lo + k*MRKBLK; mm < last; mm++) {
+        for (w = 1; w <= wsize && mm + w < ntst; w++) {
+            if (!in_window(mm, w))
+                continue;
+            if (phase_em)
+                count_geno_cells(mtst[mm], mtst[mm+w], ht);
+            else
+                count_cells(mtst[mm], mtst[mm+w], cacnt, chcnt);
+            for (s = 0; s < NSTRAT; s++) {
+                if (!strata[s].n)
                     continue;
-                if (all1[i][m1] != -1) {
-                    if (all1[i][m2] != -1)
-                        acnt[0][all1[i][m1]]++;
-                        acnt[1][all1[i][m2]]++;
-                        hcnt2[all1[i][m1]][all1[i][m2]]++;
-#ifdef PHASE_UNKNOWN
-                    if (all2[i][m2] != -1)
-                        hcnt2[all1[i][m1]][all2[i][m2]]++;
-#endif
+                slot = s*chunk + mm - job->lo;
+                if (phase_em) {
+                    for (c = 0; c < strata[s].ncell; c++) {
+                        cht = &ht[strata[s].cells[c]];
+                        for (i = 0; i < cht->nkey; i++)
+                            ht_add(sht, cht->key[i], cht->cnt[cht->key[i]]);
+                    }
+                    em_freqs(mtst[mm], mtst[mm+w], sht, afrq, hfrq2);
+                    ht_clear(sht);
                 }
-                if (all2[i][m1] != -1) {
-#ifdef PHASE_UNKNOWN
-                    if (all1[i][m2] != -1)
-                        hcnt2[all2[i][m1]][all1[i][m2]]++;
-#endif
-                    if (all2[i][m2] != -1)
-                        acnt[0][all2[i][m1]]++;
-                        acnt[1][all2[i][m2]]++;
-                        hcnt2[all2[i][m1]][all2[i][m2]]++;
+                else {
+                    sum_cells(&strata[s], mtst[mm], mtst[mm+w], cacnt, chcnt,
+                              acnt, hcnt2);
+                    count_freqs(mtst[mm], mtst[mm+w], acnt, hcnt2, afrq,
+                                hfrq2);
                 }
+                job->band[slot*wsize + w-1] =
+                    test_pair(&strata[s], mm, mm + w, afrq, hfrq2,
+                              &job->out[slot]);
             }
-
-            sum = 0;
-            for (i = 0; i < mrk[m1].nall; i++) {
-                sum += acnt[0][i];
-            }
-            asum = 0;
-            for (i = 0; i < mrk[m1].nall; i++) {
-                afrq[0][i] = acnt[0][i]/sum;
+            if (phase_em) {
+                for (c = 0; c < ncell; c++)
+                    ht_clear(&ht[c]);
             }
+        }
+    }
 
-            sum = 0;
-            for (i = 0; i < mrk[m2].nall; i++) {
-                sum += acnt[1][i];
-            }
-            asum = 0;
-            for (i = 0; i < mrk[m2].nall; i++) {
-                afrq[1][i] = acnt[1][i]/sum;
-            }
+    if (phase_em) {
+        for (c = 0; c <= ncell; c++)
+            ht_free(&ht[c]);
+        free(ht);
+    }
+    else {
+        free(cacnt);
+        free(chcnt);
+    }
+}
 
-            nfrq = 0;
-            sum = 0;
-            for (i = 0; i < mrk[m1].nall; i++) {
-                for (j = 0; j < mrk[m2].nall; j++) {
-                    sum += hcnt2[i][j];
-                    nfrq++;
-                }
-            }
+/*
+ *  Tally the allele and 2-locus haplotype counts of markers m1 and m2 in
+ *  each cell, in one pass over the genotypes. Pairs of biallelic markers
+ *  are counted from their bit planes.
+ */
 
-            dprime = 0;
-            asum = 0;
-            for (i = 0; i < mrk[m1].nall; i++) {
-                if (!afrq[0][i]) continue;
-                for (j = 0; j < mrk[m2].nall; j++) {
-                    if (!afrq[1][j]) continue;
-                    hfrq2[i][j] = hcnt2[i][j]/sum;
-                    td2[m1][m2][i][j] = hfrq2[i][j] - afrq[0][i]*afrq[1][j];
-                    if (td2[m1][m2][i][j] < 0)
-                        dmax = min(afrq[0][i]*afrq[1][j],
-                                   (1-afrq[0][i])*(1-afrq[1][j]));
-                    else
-                        dmax = min(afrq[0][i]*(1-afrq[1][j]),
-                                   (1-afrq[0][i])*afrq[1][j]);
-                    if (dmax)
-                        dprime +=
-                            afrq[0][i]*afrq[1][j]*fabs(td2[m1][m2][i][j]/dmax);
-                }
-            }
+void count_cells (int m1, int m2, int (*cacnt)[2][MXALL],
+                  int (*chcnt)[MXALL][MXALL])
+{
+    int i, j, c, c1, c2, cnt[4];
+    int nall1 = mrk[m1].nall, nall2 = mrk[m2].nall;
+    int (*acnt)[MXALL], (*hcnt2)[MXALL];
+    uint8_t *g1[2], *g2[2];
+
+    for (c = 0; c < ncell; c++) {
+        for (i = 0; i < nall1; i++) {
+            cacnt[c][0][i] = 0;
+            for (j = 0; j < nall2; j++)
+                chcnt[c][i][j] = 0;
+        }
+        for (j = 0; j < nall2; j++)
+            cacnt[c][1][j] = 0;
+    }
 
-            fprintf(fp, "\n%sMARKERS: %s %s\n", indent, mrk[m1].name,
-                    mrk[m2].name);
-            fprintf(fp, "%sD' = %g\n", indent, dprime);
-            fprintf(fp, "%sALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL\n",
-                    indent);
-
-            for (ii = 0; ii < mrk[m1].nall; ii++) {
-                i = mrk[m1].all_sort[ii];
-                for (jj = 0; jj < mrk[m2].nall; jj++) {
-                    j = mrk[m2].all_sort[jj];
-                    if (tpi[m1][i] && tpi[m2][j]) {
-                        chi = n * pow(td2[m1][m2][i][j],2.)/(tpi[m1][i]*tpi[m2][j]);
-                        if (chi == 0) {
-                            fprintf(fp, "%s%-5s %-5s  %8.6f %9.6f %9.6f  %8.6f\n",
-                                    indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
-                                    hfrq2[i][j], td2[m1][m2][i][j], chi, 1.);
-                        }
-                        else {
-                            fprintf(fp, "%s%-5s %-5s  %8.6f %9.6f %9.6f  %8.6f\n",
-                                    indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
-                                    hfrq2[i][j], td2[m1][m2][i][j], chi,
-                                    1 - pchis_(&chi, &df));
-                        }
-                    } else {
-                        fprintf(fp, "%s%-5s %-5s  %8.6f %9.6f   ******    ******\n",
-                                indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
-                                hfrq2[i][j], td2[m1][m2][i][j]);
+    if (nall1 <= 2 && nall2 <= 2) {
+        for (c = 0; c < ncell; c++) {
+            acnt = cacnt[c];
+            hcnt2 = chcnt[c];
+            for (c1 = 0; c1 < 2; c1++) {
+                for (c2 = 0; c2 < 2; c2++) {
+#ifndef PHASE_UNKNOWN
+                    if (c1 != c2)
+                        continue;
+#endif
+                    gb_count(&bgeno, m1, c1, m2, c2, c, cnt);
+                    if (nall1 == 2 && nall2 == 2)
+                        hcnt2[1][1] += cnt[3];
+                    if (nall1 == 2)
+                        hcnt2[1][0] += cnt[1] - cnt[3];
+                    if (nall2 == 2)
+                        hcnt2[0][1] += cnt[2] - cnt[3];
+                    hcnt2[0][0] += cnt[0] - cnt[1] - cnt[2] + cnt[3];
+                    if (c1 == c2) {
+                        if (nall1 == 2)
+                            acnt[0][1] += cnt[1];
+                        acnt[0][0] += cnt[0] - cnt[1];
+                        if (nall2 == 2)
+                            acnt[1][1] += cnt[2];
+                        acnt[1][0] += cnt[0] - cnt[2];
                     }
                 }
             }
         }
+        return;
     }
-}
 
-void do_3locus_tests (FILE *fp, int ipop, int iaff)
-{
-    int i, j, k, ii, jj, kk, n, nfrq;
-    int m, m1, m2, m3, mm1, mm2;
-    int hcnt3[MXALL][MXALL][MXALL];
-    double hfrq3[MXALL][MXALL][MXALL];
-    double ****td2, **tafreq, **tpi, **ttau;
-    double freq, sum, asum;
-    double chi, var, df = 1, pchis_();
-    char buf[10], indent[10];
+    g1[0] = GM_ALL1(&geno, m1);
+    g2[0] = GM_ALL2(&geno, m1);
+    g1[1] = GM_ALL1(&geno, m2);
+    g2[1] = GM_ALL2(&geno, m2);
 
-    if (ipop == -1) {
-        if (iaff == 1) {
-            tafreq = afrequ;
-            tpi = piu;
-            ttau = tauu;
-            td2 = d2u;
-        }
-        else if (iaff == 2) {
-            tafreq = afreqa;
-            tpi = pia;
-            ttau = taua;
-            td2 = d2a;
-        }
-        else {
-            tafreq = afreq;
-            tpi = pi;
-            ttau = tau;
-            td2 = d2;
-        }
-        strcpy(indent, "   ");
-    }
-    else {
-        if (iaff == 1) {
-            tafreq = afreqpu[ipop];
-            tpi = pipu[ipop];
-            ttau = taupu[ipop];
-            td2 = d2pu[ipop];
-        }
-        else if (iaff == 2) {
-            tafreq = afreqpa[ipop];
-            tpi = pipa[ipop];
-            ttau = taupa[ipop];
-            td2 = d2pa[ipop];
+    for (i = 0; i < nind; i++) {
+        acnt = cacnt[cell[i]];
+        hcnt2 = chcnt[cell[i]];
+        if (g1[0][i] != GM_MISSING) {
+            if (g1[1][i] != GM_MISSING) {
+                acnt[0][g1[0][i]]++;
+                acnt[1][g1[1][i]]++;
+                hcnt2[g1[0][i]][g1[1][i]]++;
+            }
+#ifdef PHASE_UNKNOWN
+            if (g2[1][i] != GM_MISSING)
+                hcnt2[g1[0][i]][g2[1][i]]++;
+#endif
         }
-        else {
-            tafreq = afreqp[ipop];
-            tpi = pip[ipop];
-            ttau = taup[ipop];
-            td2 = d2p[ipop];
+        if (g2[0][i] != GM_MISSING) {
+#ifdef PHASE_UNKNOWN
+            if (g1[1][i] != GM_MISSING)
+                hcnt2[g2[0][i]][g1[1][i]]++;
+#endif
+            if (g2[1][i] != GM_MISSING) {
+                acnt[0][g2[0][i]]++;
+                acnt[1][g2[1][i]]++;
+                hcnt2[g2[0][i]][g2[1][i]]++;
+            }
         }
-        strcpy(indent, "      ");
     }
+}
 
-    n = 0;
+/*
+ *  Sum the counts of markers m1 and m2 over the cells of a stratum.
+ */
+
+void sum_cells (struct Stratum *st, int m1, int m2, int (*cacnt)[2][MXALL],
+                int (*chcnt)[MXALL][MXALL], int acnt[2][MXALL],
+                int hcnt2[MXALL][MXALL])
+{
+    int i, j, c, k;
+    int nall1 = mrk[m1].nall, nall2 = mrk[m2].nall;
+
+    for (i = 0; i < nall1; i++) {
+        acnt[0][i] = 0;
+        for (j = 0; j < nall2; j++)
+            hcnt2[i][j] = 0;
+    }
+    for (j = 0; j < nall2; j++)
+        acnt[1][j] = 0;
+
+    for (k = 0; k < st->ncell; k++) {
+        c = st->cells[k];
+        for (i = 0; i < nall1; i++) {
+            acnt[0][i] += cacnt[c][0][i];
+            for (j = 0; j < nall2; j++)
+                hcnt2[i][j] += chcnt[c][i][j];
+        }
+        for (j = 0; j < nall2; j++)
+            acnt[1][j] += cacnt[c][1][j];
+    }
+}
+
+/*
+ *  Allele and 2-locus haplotype frequencies from counts. A haplotype
+ *  frequency is left 0 unless both of its alleles have been counted.
+ */
+
+void count_freqs (int m1, int m2, int acnt[2][MXALL], int hcnt2[MXALL][MXALL],
+                  double afrq[2][MXALL], double hfrq2[MXALL][MXALL])
+{
+    int i, j;
+    double sum;
+
+    sum = 0;
+    for (i = 0; i < mrk[m1].nall; i++) {
+        sum += acnt[0][i];
+    }
+    for (i = 0; i < mrk[m1].nall; i++) {
+        afrq[0][i] = acnt[0][i]/sum;
+    }
+
+    sum = 0;
+    for (i = 0; i < mrk[m2].nall; i++) {
+        sum += acnt[1][i];
+    }
+    for (i = 0; i < mrk[m2].nall; i++) {
+        afrq[1][i] = acnt[1][i]/sum;
+    }
+
+    sum = 0;
+    for (i = 0; i < mrk[m1].nall; i++) {
+        for (j = 0; j < mrk[m2].nall; j++) {
+            sum += hcnt2[i][j];
+        }
+    }
+
+    for (i = 0; i < mrk[m1].nall; i++) {
+        for (j = 0; j < mrk[m2].nall; j++) {
+            if (afrq[0][i] && afrq[1][j])
+                hfrq2[i][j] = hcnt2[i][j]/sum;
+            else
+                hfrq2[i][j] = 0;
+        }
+    }
+}
+
+/*
+ *  Tally the genotype pairs of markers m1 and m2 in each cell, from the
+ *  individuals typed for both alleles at both markers. The genotype
+ *  a/b, a >= b, is numbered a*(a+1)/2 + b, and the pair of genotypes
+ *  g1, g2 is keyed by g1*NGENO(nall2) + g2. Pairs of biallelic markers
+ *  are counted from their bit planes.
+ */
+
+void count_geno_cells (int m1, int m2, struct HapTable *ht)
+{
+    int i, c, g1, g2, a, b, cnt[3][3];
+    int ngen2 = NGENO(mrk[m2].nall);
+    uint8_t *x1, *y1, *x2, *y2;
+
+    if (mrk[m1].nall <= 2 && mrk[m2].nall <= 2) {
+        for (c = 0; c < ncell; c++) {
+            gb_count_geno(&bgeno, m1, m2, c, cnt);
+            for (g1 = 0; g1 < 3; g1++) {
+                for (g2 = 0; g2 < 3; g2++) {
+                    if (cnt[g1][g2])
+                        ht_add(&ht[c], g1*ngen2 + g2, cnt[g1][g2]);
+                }
+            }
+        }
+        return;
+    }
+
+    x1 = GM_ALL1(&geno, m1);
+    y1 = GM_ALL2(&geno, m1);
+    x2 = GM_ALL1(&geno, m2);
+    y2 = GM_ALL2(&geno, m2);
+
+    for (i = 0; i < nind; i++) {
+        if (x1[i] == GM_MISSING || y1[i] == GM_MISSING
+                || x2[i] == GM_MISSING || y2[i] == GM_MISSING)
+            continue;
+        a = x1[i] > y1[i] ? x1[i] : y1[i];
+        b = x1[i] + y1[i] - a;
+        g1 = a*(a + 1)/2 + b;
+        a = x2[i] > y2[i] ? x2[i] : y2[i];
+        b = x2[i] + y2[i] - a;
+        g2 = a*(a + 1)/2 + b;
+        ht_add(&ht[cell[i]], g1*ngen2 + g2, 1);
+    }
+}
+
+/*
+ *  The alleles a[0] >= a[1] of genotype number g.
+ */
+
+void geno_alleles (int g, int *a)
+{
+    for (a[0] = 0; (a[0] + 1)*(a[0] + 2)/2 <= g; a[0]++) ;
+    a[1] = g - a[0]*(a[0] + 1)/2;
+}
+
+/*
+ *  Estimate the allele and 2-locus haplotype frequencies of markers m1
+ *  and m2 by EM, from the genotype pair counts of a stratum. Only the
+ *  double heterozygotes are of unknown phase; the EM runs over their
+ *  distinct genotype pairs, so its cost does not depend on the number
+ *  of individuals. For two biallelic markers, the estimate is found
+ *  directly as a root of a cubic.
+ */
+
+void em_freqs (int m1, int m2, struct HapTable *ht, double afrq[2][MXALL],
+               double hfrq2[MXALL][MXALL])
+{
+    int i, j, k, n, key, ndh, iter;
+    int nall1 = mrk[m1].nall, nall2 = mrk[m2].nall, ngen2 = NGENO(nall2);
+    int a[2], b[2], (*dh)[5];
+    int known[MXALL][MXALL];
+    double nhap, w, p1, p2, delta, x;
+    double hnew[MXALL][MXALL];
+
+    for (i = 0; i < nall1; i++) {
+        afrq[0][i] = 0;
+        for (j = 0; j < nall2; j++)
+            known[i][j] = 0;
+    }
+    for (j = 0; j < nall2; j++)
+        afrq[1][j] = 0;
+
+    /* the haplotypes of all but double heterozygotes are known */
+    dh = (int (*)[5]) allocMem((ht->nkey + 1)*sizeof(*dh));
+    ndh = 0;
+    nhap = 0;
+    for (k = 0; k < ht->nkey; k++) {
+        key = ht->key[k];
+        n = ht->cnt[key];
+        geno_alleles(key/ngen2, a);
+        geno_alleles(key%ngen2, b);
+        nhap += 2*n;
+        afrq[0][a[0]] += n;
+        afrq[0][a[1]] += n;
+        afrq[1][b[0]] += n;
+        afrq[1][b[1]] += n;
+        if (a[0] != a[1] && b[0] != b[1]) {
+            dh[ndh][0] = a[0];
+            dh[ndh][1] = a[1];
+            dh[ndh][2] = b[0];
+            dh[ndh][3] = b[1];
+            dh[ndh][4] = n;
+            ndh++;
+        }
+        else {
+            known[a[0]][b[0]] += n;
+            known[a[1]][b[1]] += n;
+        }
+    }
+
+    for (i = 0; i < nall1; i++)
+        afrq[0][i] /= nhap;
+    for (j = 0; j < nall2; j++)
+        afrq[1][j] /= nhap;
+
+    /* start from an even split of the double heterozygotes */
+    for (i = 0; i < nall1; i++) {
+        for (j = 0; j < nall2; j++)
+            hfrq2[i][j] = known[i][j];
+    }
+    for (k = 0; k < ndh; k++) {
+        hfrq2[dh[k][0]][dh[k][2]] += .5*dh[k][4];
+        hfrq2[dh[k][1]][dh[k][3]] += .5*dh[k][4];
+        hfrq2[dh[k][0]][dh[k][3]] += .5*dh[k][4];
+        hfrq2[dh[k][1]][dh[k][2]] += .5*dh[k][4];
+    }
+    for (i = 0; i < nall1; i++) {
+        for (j = 0; j < nall2; j++)
+            hfrq2[i][j] /= nhap;
+    }
+
+    if (ndh && nall1 == 2 && nall2 == 2
+            && em_cubic(afrq[0][0], afrq[1][0], nhap, known, dh[0][4], &x)) {
+        hfrq2[0][0] = x;
+        hfrq2[0][1] = afrq[0][0] - x;
+        hfrq2[1][0] = afrq[1][0] - x;
+        hfrq2[1][1] = 1 - afrq[0][0] - afrq[1][0] + x;
+        ndh = 0;
+    }
+
+    for (iter = 0; ndh && iter < EM_MAXIT; iter++) {
+        for (i = 0; i < nall1; i++) {
+            for (j = 0; j < nall2; j++)
+                hnew[i][j] = known[i][j];
+        }
+        for (k = 0; k < ndh; k++) {
+            p1 = hfrq2[dh[k][0]][dh[k][2]]*hfrq2[dh[k][1]][dh[k][3]];
+            p2 = hfrq2[dh[k][0]][dh[k][3]]*hfrq2[dh[k][1]][dh[k][2]];
+            w = p1 + p2 > 0 ? p1/(p1 + p2) : .5;
+            hnew[dh[k][0]][dh[k][2]] += w*dh[k][4];
+            hnew[dh[k][1]][dh[k][3]] += w*dh[k][4];
+            hnew[dh[k][0]][dh[k][3]] += (1 - w)*dh[k][4];
+            hnew[dh[k][1]][dh[k][2]] += (1 - w)*dh[k][4];
+        }
+        delta = 0;
+        for (i = 0; i < nall1; i++) {
+            for (j = 0; j < nall2; j++) {
+                hnew[i][j] /= nhap;
+                if (fabs(hnew[i][j] - hfrq2[i][j]) > delta)
+                    delta = fabs(hnew[i][j] - hfrq2[i][j]);
+                hfrq2[i][j] = hnew[i][j];
+            }
+        }
+        if (delta < EM_TOL)
+            break;
+    }
+
+    for (i = 0; i < nall1; i++) {
+        for (j = 0; j < nall2; j++) {
+            if (!afrq[0][i] || !afrq[1][j])
+                hfrq2[i][j] = 0;
+        }
+    }
+
+    free(dh);
+}
+
+/*
+ *  The EM estimate of the frequency x of haplotype 0-0 of two biallelic
+ *  markers, with allele 0 frequencies p and q, from nhap haplotypes of
+ *  which known are of known phase and the rest come from nd double
+ *  heterozygotes. The fixed points of the EM are the roots of
+ *
+ *      (nhap*x - n00)*(2x^2 + (1 - 2p - 2q)*x + pq) - nd*x*(1 - p - q + x)
+ *
+ *  and the root in the admissible range of greatest likelihood is
+ *  taken. Returns 0 if there is no such root.
+ */
+
+int em_cubic (double p, double q, double nhap, int known[MXALL][MXALL], int nd,
+              double *x)
+{
+    int i, k, nroot, found;
+    double c[4], b, e, d, qq, r, t, a, lo, hi, f, df, lik, best;
+    double h[4], root[3];
+    int n00 = known[0][0];
+
+    c[3] = 2*nhap;
+    c[2] = nhap*(1 - 2*p - 2*q) - 2*n00 - nd;
+    c[1] = nhap*p*q - n00*(1 - 2*p - 2*q) - nd*(1 - p - q);
+    c[0] = -n00*p*q;
+
+    /* real roots of the monic cubic x^3 + b x^2 + e x + d */
+    b = c[2]/c[3];
+    e = c[1]/c[3];
+    d = c[0]/c[3];
+    qq = (b*b - 3*e)/9;
+    r = (2*b*b*b - 9*b*e + 27*d)/54;
+    if (r*r < qq*qq*qq) {
+        t = acos(r/sqrt(qq*qq*qq));
+        nroot = 3;
+        for (k = 0; k < 3; k++)
+            root[k] = -2*sqrt(qq)*cos((t + 2*M_PI*(k - 1))/3) - b/3;
+    }
+    else {
+        a = -copysign(cbrt(fabs(r) + sqrt(r*r - qq*qq*qq)), r);
+        nroot = 1;
+        root[0] = a + (a ? qq/a : 0) - b/3;
+    }
+
+    lo = p + q - 1 > 0 ? p + q - 1 : 0;
+    hi = min(p, q);
+    found = 0;
+    best = 0;
+    for (k = 0; k < nroot; k++) {
+        /* polish the root by Newton's method */
+        for (i = 0; i < 3; i++) {
+            f = ((c[3]*root[k] + c[2])*root[k] + c[1])*root[k] + c[0];
+            df = (3*c[3]*root[k] + 2*c[2])*root[k] + c[1];
+            if (df)
+                root[k] -= f/df;
+        }
+        if (root[k] < lo - 1e-9 || root[k] > hi + 1e-9)
+            continue;
+        if (root[k] < lo)
+            root[k] = lo;
+        if (root[k] > hi)
+            root[k] = hi;
+
+        h[0] = root[k];
+        h[1] = p - root[k];
+        h[2] = q - root[k];
+        h[3] = 1 - p - q + root[k];
+        lik = 0;
+        for (i = 0; i < 4; i++) {
+            if (known[i/2][i%2])
+                lik += known[i/2][i%2]*log(h[i]);
+        }
+        lik += nd*log(h[0]*h[3] + h[1]*h[2]);
+        if (!found || lik > best) {
+            found = 1;
+            best = lik;
+            *x = root[k];
+        }
+    }
+
+    return found;
+}
+
+/*
+ *  Is the pair (mm, mm+k) of the test list within the window? The pair
+ *  is if k <= wsize and, if a maximum distance was given, the markers
+ *  are no farther apart than that.
+ */
+
+int in_window (int mm, int k)
+{
+    return mm + k < ntst && k <= wsize
+           && (!maxdist || fabs(mpos[mm+k] - mpos[mm]) <= maxdist);
+}
+
+/*
+ *  Test markers mm1 and mm2 of the test list for LD in a stratum, given
+ *  their allele and haplotype frequencies in the stratum, and append the
+ *  results to out. Returns D'.
+ */
+
+double test_pair (struct Stratum *st, int mm1, int mm2, double afrq[2][MXALL],
+                  double hfrq2[MXALL][MXALL], struct Text *out)
+{
+    int i, j, ii, jj, n = st->n;
+    int m1, m2, nchi, ai[MXALL*MXALL], aj[MXALL*MXALL];
+    double *pd2, **tpi = st->tpi;
+    double d, dmax, dprime, d2buf[MXALL*MXALL];
+    double chi[MXALL*MXALL], pval[MXALL*MXALL], pemp[MXALL*MXALL];
+    char *indent = st->indent;
+
+    m1 = mtst[mm1];
+    m2 = mtst[mm2];
+    if (!(pd2 = dt_pair(st->td2, mm1, mm2 - mm1))) {
+        pd2 = d2buf;
+        for (i = 0; i < mrk[m1].nall*mrk[m2].nall; i++)
+            pd2[i] = 0;
+    }
+
+    dprime = 0;
+    for (i = 0; i < mrk[m1].nall; i++) {
+        if (!afrq[0][i]) continue;
+        for (j = 0; j < mrk[m2].nall; j++) {
+            if (!afrq[1][j]) continue;
+            d = hfrq2[i][j] - afrq[0][i]*afrq[1][j];
+            pd2[i*mrk[m2].nall + j] = d;
+            if (d < 0)
+                dmax = min(afrq[0][i]*afrq[1][j],
+                           (1-afrq[0][i])*(1-afrq[1][j]));
+            else
+                dmax = min(afrq[0][i]*(1-afrq[1][j]),
+                           (1-afrq[0][i])*afrq[1][j]);
+            if (dmax)
+                dprime += fabs(d/dmax)*afrq[0][i]*afrq[1][j];
+        }
+    }
+
+    if (band)
+        return dprime;
+
+    text_printf(out, "\n%sMARKERS: %s %s\n", indent, mrk[m1].name,
+                mrk[m2].name);
+    text_printf(out, "%sD' = %g\n", indent, dprime);
+    text_printf(out, "%sALL1  ALL2    H2FREQ      D2       CHI2     1-PVAL%s\n",
+                indent, nperm ? "     EMP-P" : "");
+
+    /* all the statistics first, so that the p-values go in one batch */
+    nchi = 0;
+    for (ii = 0; ii < mrk[m1].nall; ii++) {
+        i = mrk[m1].all_sort[ii];
+        for (jj = 0; jj < mrk[m2].nall; jj++) {
+            j = mrk[m2].all_sort[jj];
+            if (tpi[m1][i] && tpi[m2][j]) {
+                ai[nchi] = i;
+                aj[nchi] = j;
+                chi[nchi++] = n * pow(pd2[i*mrk[m2].nall + j],2.)
+                                  /(tpi[m1][i]*tpi[m2][j]);
+            }
+        }
+    }
+    chi_p_array(nchi, chi, 1, pval);
+    if (nperm)
+        perm_pvals(st, mm1, mm2, nchi, ai, aj, chi, pemp);
+
+    nchi = 0;
+    for (ii = 0; ii < mrk[m1].nall; ii++) {
+        i = mrk[m1].all_sort[ii];
+        for (jj = 0; jj < mrk[m2].nall; jj++) {
+            j = mrk[m2].all_sort[jj];
+            if (tpi[m1][i] && tpi[m2][j]) {
+                text_printf(out, "%s%-5s %-5s  %8.6f %9.6f %9.6f  %8.6f",
+                        indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
+                        hfrq2[i][j], pd2[i*mrk[m2].nall + j], chi[nchi],
+                        pval[nchi]);
+                if (nperm)
+                    text_printf(out, "  %8.6f", pemp[nchi]);
+                text_printf(out, "\n");
+                nchi++;
+            } else {
+                text_printf(out, "%s%-5s %-5s  %8.6f %9.6f   ******    ******%s\n",
+                        indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
+                        hfrq2[i][j], pd2[i*mrk[m2].nall + j],
+                        nperm ? "    ******" : "");
+            }
+        }
+    }
+
+    return dprime;
+}
+
+/*
+ *  Prune the test list by LD, and write the names of the markers kept
+ *  to fp. Walking down the list, each marker is kept unless its r2 with
+ *  an earlier marker that was kept, in whose window it lies, is above
+ *  prune_r2. The r2 of the pairs of a chunk of the list are found in
+ *  parallel, skipping the markers already pruned, and the chunk is then
+ *  walked in order, so the list does not depend on the number of
+ *  threads.
+ */
+
+void prune_markers (FILE *fp)
+{
+    int mm, w, lo, hi;
+    struct Stratum st;
+    struct PruneJob job;
+
+    set_stratum(&st, -1, 0);
+    job.st = &st;
+    job.keep = (char *) allocMem(ntst);
+    job.r2 = (float *) allocMem(chunk*wsize*sizeof(float));
+    for (mm = 0; mm < ntst; mm++)
+        job.keep[mm] = 1;
+
+    for (lo = 0; lo < ntst; lo += chunk) {
+        hi = min(lo + chunk, ntst);
+        load_window(lo, min(hi + wsize, ntst));
+        job.lo = lo;
+        job.hi = hi;
+
+        run_tasks(nthread, (hi - lo + MRKBLK - 1)/MRKBLK, prune_task, &job);
+
+        for (mm = lo; mm < hi; mm++) {
+            if (!job.keep[mm])
+                continue;
+            for (w = 1; w <= wsize && mm + w < ntst; w++) {
+                if (in_window(mm, w)
+                        && job.r2[(mm - lo)*wsize + w-1] > prune_r2)
+                    job.keep[mm+w] = 0;
+            }
+            fprintf(fp, "%s\n", mrk[mtst[mm]].name);
+        }
+    }
+
+    free(job.keep);
+    free(job.r2);
+    free(st.cells);
+    free(st.ind);
+}
+
+/*
+ *  Find the r2 of the pairs of block k of MRKBLK markers of a chunk, in
+ *  the total sample, from haplotype frequencies estimated by EM.
+ */
+
+void prune_task (int k, void *arg)
+{
+    struct PruneJob *job = (struct PruneJob *) arg;
+    int mm, w, c, i, last, size, maxsize;
+    double afrq[2][MXALL], hfrq2[MXALL][MXALL];
+    struct HapTable *ht, *cht, *sht;
+
+    last = min(job->lo + (k + 1)*MRKBLK, job->hi);
+
+    maxsize = 0;
+    for (mm = job->lo + k*MRKBLK; mm < last; mm++) {
+        for (w = 1; w <= wsize && mm + w < ntst; w++) {
+            size = NGENO(mrk[mtst[mm]].nall)*NGENO(mrk[mtst[mm+w]].nall);
+            if (size > maxsize)
+                maxsize = size;
+        }
+    }
+    ht = (struct HapTable *) allocMem((ncell + 1)*sizeof(struct HapTable));
+    for (c = 0; c <= ncell; c++)
+        ht_alloc(&ht[c], maxsize);
+    sht = &ht[ncell];
+
+    for (mm = job->lo + k*MRKBLK; mm < last; mm++) {
+        if (!job->keep[mm])
+            continue;
+        for (w = 1; w <= wsize && mm + w < ntst; w++) {
+            if (!in_window(mm, w))
+                continue;
+            count_geno_cells(mtst[mm], mtst[mm+w], ht);
+            for (c = 0; c < job->st->ncell; c++) {
+                cht = &ht[job->st->cells[c]];
+                for (i = 0; i < cht->nkey; i++)
+                    ht_add(sht, cht->key[i], cht->cnt[cht->key[i]]);
+            }
+            em_freqs(mtst[mm], mtst[mm+w], sht, afrq, hfrq2);
+            job->r2[(mm - job->lo)*wsize + w-1] =
+                pair_r2(mtst[mm], mtst[mm+w], afrq, hfrq2);
+            for (c = 0; c <= ncell; c++)
+                ht_clear(&ht[c]);
+        }
+    }
+
+    for (c = 0; c <= ncell; c++)
+        ht_free(&ht[c]);
+    free(ht);
+}
+
+/*
+ *  The r2 of markers m1 and m2, given their allele and haplotype
+ *  frequencies: the largest D(i,j)^2/(p(i)(1-p(i))p(j)(1-p(j))) over the
+ *  pairs of alleles, which for two biallelic markers is the squared
+ *  correlation of their alleles on a haplotype. A marker with only one
+ *  allele has r2 0 with any other.
+ */
+
+double pair_r2 (int m1, int m2, double afrq[2][MXALL],
+                double hfrq2[MXALL][MXALL])
+{
+    int i, j;
+    double d, var, r2;
+
+    r2 = 0;
+    for (i = 0; i < mrk[m1].nall; i++) {
+        for (j = 0; j < mrk[m2].nall; j++) {
+            var = afrq[0][i]*(1 - afrq[0][i])*afrq[1][j]*(1 - afrq[1][j]);
+            if (!(var > 0))
+                continue;
+            d = hfrq2[i][j] - afrq[0][i]*afrq[1][j];
+            if (d*d/var > r2)
+                r2 = d*d/var;
+        }
+    }
+
+    return r2;
+}
+
+/*
+ *  Empirical p-values of the nchi statistics chi[] of markers mm1 and
+ *  mm2 of the test list in a stratum, the statistic of alleles ai[k] and
+ *  aj[k] being chi[k]. The genotypes of mm2 are permuted among the
+ *  individuals of the stratum, and the allele and haplotype frequencies,
+ *  and so the statistics, are found again just as for the observed
+ *  genotypes. A p-value is resolved once PERM_HITS permuted statistics
+ *  are at least as large as the observed one, and is then the fraction
+ *  of such permutations so far; the permutations stop when every p-value
+ *  is resolved, or after nperm, when the p-value of a statistic reached
+ *  by r permuted ones is (r+1)/(nperm+1).
+ *
+ *  Each genotype is coded as its ordered pair of alleles, the missing
+ *  allele coded as nall. The codes of mm2 are shuffled in place, each
+ *  permutation starting from the one before, and when the table of
+ *  every pair of codes of the two markers is small, as it is for two
+ *  biallelic markers, each permutation only adds one to an entry of the
+ *  table for each individual. The random numbers are drawn from a stream
+ *  of its own for each pair of markers and stratum, so the p-values do
+ *  not depend on the number of threads or on the window size.
+ */
+
+void perm_pvals (struct Stratum *st, int mm1, int mm2, int nchi, int *ai,
+                 int *aj, double *chi, double *pemp)
+{
+    int i, j, k, t, c, nc1, nc2, nleft, n = st->n;
+    int m1 = mtst[mm1], m2 = mtst[mm2], na1, na2, size;
+    int *c1, *c2, *tab, hits[MXALL*MXALL];
+    int acnt[2][MXALL], hcnt2[MXALL][MXALL];
+    double afrq[2][MXALL], hfrq2[MXALL][MXALL];
+    double d, pchi, **tpi = st->tpi;
+    uint64_t key, ctr;
+    uint8_t *x1, *y1, *x2, *y2;
+    struct HapTable ht;
+
+    na1 = mrk[m1].nall + 1;
+    na2 = mrk[m2].nall + 1;
+    nc1 = na1*na1;
+    nc2 = na2*na2;
+    x1 = GM_ALL1(&geno, m1);
+    y1 = GM_ALL2(&geno, m1);
+    x2 = GM_ALL1(&geno, m2);
+    y2 = GM_ALL2(&geno, m2);
+
+    c1 = (int *) allocMem((2*n + 1)*sizeof(int));
+    c2 = c1 + n;
+    for (t = 0; t < n; t++) {
+        i = st->ind[t];
+        c1[t] = (x1[i] == GM_MISSING ? na1 - 1 : x1[i])*na1
+                + (y1[i] == GM_MISSING ? na1 - 1 : y1[i]);
+        c2[t] = (x2[i] == GM_MISSING ? na2 - 1 : x2[i])*na2
+                + (y2[i] == GM_MISSING ? na2 - 1 : y2[i]);
+    }
+    tab = nc1*nc2 <= PERM_TAB ? (int *) allocMem(nc1*nc2*sizeof(int)) : 0;
+    if (phase_em) {
+        size = NGENO(mrk[m1].nall)*NGENO(mrk[m2].nall);
+        ht_alloc(&ht, size);
+    }
+
+    key = ctr_rand(PERM_SEED,
+                   ((uint64_t) m1*nmrk + m2)*NSTRAT + (st - strata));
+    ctr = 0;
+
+    for (k = 0; k < nchi; k++)
+        hits[k] = 0;
+    nleft = nchi;
+
+    for (j = 1; j <= nperm && nleft; j++) {
+        shuffle(c2, n, key, &ctr);
+
+        for (i = 0; i < mrk[m1].nall; i++) {
+            acnt[0][i] = 0;
+            for (k = 0; k < mrk[m2].nall; k++)
+                hcnt2[i][k] = 0;
+        }
+        for (k = 0; k < mrk[m2].nall; k++)
+            acnt[1][k] = 0;
+
+        if (tab) {
+            for (c = 0; c < nc1*nc2; c++)
+                tab[c] = 0;
+            for (t = 0; t < n; t++)
+                tab[c1[t]*nc2 + c2[t]]++;
+            for (c = 0; c < nc1*nc2; c++) {
+                if (tab[c])
+                    add_perm_pair(m1, m2, c/nc2, c%nc2, na1, na2, tab[c],
+                                  acnt, hcnt2, &ht);
+            }
+        }
+        else {
+            for (t = 0; t < n; t++)
+                add_perm_pair(m1, m2, c1[t], c2[t], na1, na2, 1,
+                              acnt, hcnt2, &ht);
+        }
+
+        if (phase_em) {
+            em_freqs(m1, m2, &ht, afrq, hfrq2);
+            ht_clear(&ht);
+        }
+        else
+            count_freqs(m1, m2, acnt, hcnt2, afrq, hfrq2);
+
+        for (k = 0; k < nchi; k++) {
+            if (hits[k] == PERM_HITS)
+                continue;
+            d = hfrq2[ai[k]][aj[k]] - afrq[0][ai[k]]*afrq[1][aj[k]];
+            pchi = n * pow(d,2.)/(tpi[m1][ai[k]]*tpi[m2][aj[k]]);
+            if (pchi >= chi[k]*(1 - 1e-9) && ++hits[k] == PERM_HITS) {
+                pemp[k] = (double) PERM_HITS/j;
+                nleft--;
+            }
+        }
+    }
+
+    for (k = 0; k < nchi; k++) {
+        if (hits[k] < PERM_HITS)
+            pemp[k] = (hits[k] + 1.)/(nperm + 1.);
+    }
+
+    free(c1);
+    free(tab);
+    if (phase_em)
+        ht_free(&ht);
+}
+
+/*
+ *  Add k individuals with genotype codes g1 of marker m1 and g2 of
+ *  marker m2 to the allele and haplotype counts, as count_cells does, or
+ *  with -e, to the table of genotype pairs.
+ */
+
+void add_perm_pair (int m1, int m2, int g1, int g2, int na1, int na2, int k,
+                    int acnt[2][MXALL], int hcnt2[MXALL][MXALL],
+                    struct HapTable *ht)
+{
+    int x1 = g1/na1, y1 = g1%na1, x2 = g2/na2, y2 = g2%na2;
+    int a, b;
+
+    if (phase_em) {
+        if (x1 == mrk[m1].nall || y1 == mrk[m1].nall
+                || x2 == mrk[m2].nall || y2 == mrk[m2].nall)
+            return;
+        a = x1 > y1 ? x1 : y1;
+        b = x1 + y1 - a;
+        g1 = a*(a + 1)/2 + b;
+        a = x2 > y2 ? x2 : y2;
+        b = x2 + y2 - a;
+        g2 = a*(a + 1)/2 + b;
+        ht_add(ht, g1*NGENO(mrk[m2].nall) + g2, k);
+        return;
+    }
+
+    if (x1 != mrk[m1].nall) {
+        if (x2 != mrk[m2].nall) {
+            acnt[0][x1] += k;
+            acnt[1][x2] += k;
+            hcnt2[x1][x2] += k;
+        }
+#ifdef PHASE_UNKNOWN
+        if (y2 != mrk[m2].nall)
+            hcnt2[x1][y2] += k;
+#endif
+    }
+    if (y1 != mrk[m1].nall) {
+#ifdef PHASE_UNKNOWN
+        if (x2 != mrk[m2].nall)
+            hcnt2[y1][x2] += k;
+#endif
+        if (y2 != mrk[m2].nall) {
+            acnt[0][y1] += k;
+            acnt[1][y2] += k;
+            hcnt2[y1][y2] += k;
+        }
+    }
+}
+
+/*
+ *  Shuffle the n elements of a (Fisher-Yates), drawing the random
+ *  numbers from stream key, starting at number *ctr. Each number gives
+ *  two 32-bit halves, each scaled to the range of one swap.
+ */
+
+void shuffle (int *a, int n, uint64_t key, uint64_t *ctr)
+{
+    int i, j, tmp;
+    uint64_t r = 0;
+
+    for (i = n - 1; i > 0; i--) {
+        if ((n - i) & 1)
+            r = ctr_rand(key, (*ctr)++);
+        else
+            r >>= 32;
+        j = ((r & 0xffffffff)*(uint64_t) (i + 1)) >> 32;
+        tmp = a[i];
+        a[i] = a[j];
+        a[j] = tmp;
+    }
+}
+
+/*
+ *  Number ctr of the random stream key. The numbers are a hash of the
+ *  stream and the counter (the SplitMix64 generator), so any stream can
+ *  be drawn from anywhere without drawing the numbers before.
+ */
+
+uint64_t ctr_rand (uint64_t key, uint64_t ctr)
+{
+    uint64_t z = key + (ctr + 1)*0x9e3779b97f4a7c15ULL;
+
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/*
+ *  With -L, load the genotypes of markers lo..hi-1 of the test list from
+ *  the spill file, with the bit planes of the biallelic ones, in place
+ *  of those of the last chunk. Otherwise all markers are held already.
+ */
+
+void load_window (int lo, int hi)
+{
+    int mm;
+
+    if (!memlimit)
+        return;
+
+    gm_load(&geno, hi - lo, mtst + lo);
+    for (mm = lo; mm < hi; mm++) {
+        if (mrk[mtst[mm]].nall <= 2)
+            gb_set_marker(&bgeno, mtst[mm], GM_ALL1(&geno, mtst[mm]),
+                          GM_ALL2(&geno, mtst[mm]));
+    }
+}
+
+/*
+ *  Set up the description of the stratum of individuals in population
+ *  ipop (-1 = all) with affection status iaff (0 = all).
+ */
+
+void set_stratum (struct Stratum *st, int ipop, int iaff)
+{
+    int i;
+
+    st->ipop = ipop;
+    st->iaff = iaff;
+
+    if (ipop == -1) {
+        if (iaff == 1) {
+            st->tafreq = afrequ;
+            st->tpi = piu;
+            st->ttau = tauu;
+            st->td2 = &d2u;
+        }
+        else if (iaff == 2) {
+            st->tafreq = afreqa;
+            st->tpi = pia;
+            st->ttau = taua;
+            st->td2 = &d2a;
+        }
+        else {
+            st->tafreq = afreq;
+            st->tpi = pi;
+            st->ttau = tau;
+            st->td2 = &d2;
+        }
+        st->indent = "   ";
+    }
+    else {
+        if (iaff == 1) {
+            st->tafreq = afreqpu[ipop];
+            st->tpi = pipu[ipop];
+            st->ttau = taupu[ipop];
+            st->td2 = &d2pu[ipop];
+        }
+        else if (iaff == 2) {
+            st->tafreq = afreqpa[ipop];
+            st->tpi = pipa[ipop];
+            st->ttau = taupa[ipop];
+            st->td2 = &d2pa[ipop];
+        }
+        else {
+            st->tafreq = afreqp[ipop];
+            st->tpi = pip[ipop];
+            st->ttau = taup[ipop];
+            st->td2 = &d2p[ipop];
+        }
+        st->indent = "      ";
+    }
+
+    st->ncell = 0;
+    st->cells = (int *) allocMem(ncell*sizeof(int));
+    for (i = 0; i < ncell; i++) {
+        if (ipop != -1 && i/2 != ipop)
+            continue;
+        if (iaff != 0 && i%2 + 1 != iaff)
+            continue;
+        st->cells[st->ncell++] = i;
+    }
+
+    st->n = 0;
+    st->ind = (int *) allocMem((nind + 1)*sizeof(int));
     for (i = 0; i < nind; i++) {
         if (ipop != -1 && pop[i] != ipop)
             continue;
         if (iaff != 0 && aff[i] != iaff)
             continue;
-        n++;
-    }
-    fprintf(fp, "  (N = %d)\n", n);
-
-    if (!n) return;	/* empty subgroup, so nothing to do	*/
-
-    for (m = 0; m < ntst - 2; m++) {
-        m1 = mtst[m];
-        m2 = mtst[m+1];
-        m3 = mtst[m+2];
-        fprintf(fp, "\n%sMARKERS: %s %s %s\n", indent, mrk[m1].name, mrk[m2].name,
-                mrk[m3].name);
-        fprintf(fp, "%sALL1  ALL2  ALL3    H3FREQ      D3       CHI2     1-PVAL\n",
-                indent);
-
-        for (i = 0; i < MXALL; i++) {
-            for (j = 0; j < MXALL; j++) {
-                for (k = 0; k < MXALL; k++) {
-                    hcnt3[i][j][k] = 0;
-                    hfrq3[i][j][k] = 0;
-                }
-            }
+        st->ind[st->n++] = i;
+    }
+}
+
+/*
+ *  Write a section title of the text output.
+ */
+
+void title (FILE *fp, char *fmt, ...)
+{
+    va_list ap;
+
+    if (band)
+        return;
+    va_start(ap, fmt);
+    vfprintf(fp, fmt, ap);
+    va_end(ap);
+}
+
+/*
+ *  Write the header of the binary band matrix: the magic string, then
+ *  the number of strata, markers in the test list, and pairs per marker,
+ *  as 4-byte integers.
+ */
+
+void write_band_header (FILE *fp)
+{
+    char magic[8];
+    int32_t hdr[4];
+
+    memset(magic, 0, sizeof(magic));
+    strcpy(magic, BAND_MAGIC);
+    hdr[0] = 3*(npop + 1);
+    hdr[1] = ntst;
+    hdr[2] = wsize;
+    hdr[3] = 0;
+    fwrite(magic, 1, sizeof(magic), fp);
+    fwrite(hdr, sizeof(int32_t), 4, fp);
+}
+
+/*
+ *  Append formatted text to a growing buffer.
+ */
+
+void text_printf (struct Text *t, char *fmt, ...)
+{
+    int len;
+    va_list ap;
+
+    for (;;) {
+        va_start(ap, fmt);
+        len = vsnprintf(t->buf + t->len, t->size - t->len, fmt, ap);
+        va_end(ap);
+        if (t->len + len < t->size)
+            break;
+        t->size = 2*t->size + len + 1024;
+        t->buf = (char *) growMem(t->buf, t->size);
+    }
+    t->len += len;
+}
+
+/*
+ *  Test the triples of consecutive markers of the test list starting at
+ *  job->lo..job->hi-1, at most a chunk, in every stratum: the triples of
+ *  each block of MRKBLK markers by one task. The D of each pair of a
+ *  triple is taken from the 2-locus tests. The results are appended, in
+ *  list order, to the 3-locus temporary file of each stratum.
+ */
+
+void do_3locus_tests (struct PairJob *job)
+{
+    int s, mm;
+
+    for (mm = 0; mm < NSTRAT*chunk; mm++) {
+        job->out[mm].buf = 0;
+        job->out[mm].len = job->out[mm].size = 0;
+    }
+
+    run_tasks(nthread, (job->hi - job->lo + MRKBLK - 1)/MRKBLK, triple_task,
+              job);
+
+    for (s = 0; s < NSTRAT; s++) {
+        for (mm = s*chunk; mm < s*chunk + job->hi - job->lo; mm++) {
+            if (job->out[mm].len)
+                fwrite(job->out[mm].buf, 1, job->out[mm].len,
+                       strata[s].tmp3);
+            free(job->out[mm].buf);
         }
+    }
+}
 
-        for (i = 0; i < nind; i++) {
-            if (ipop != -1 && pop[i] != ipop)
-                continue;
-            if (iaff != 0 && aff[i] != iaff)
+/*
+ *  Test the triples of block k of MRKBLK markers of a chunk, in each
+ *  stratum. The haplotypes of each triple are counted once, by cell,
+ *  and the counts of a stratum are gathered from those of its cells.
+ */
+
+void triple_task (int k, void *arg)
+{
+    struct PairJob *job = (struct PairJob *) arg;
+    int mm, s, c, i, last, size, maxsize;
+    struct HapTable *ht, *cht, *sht;
+
+    maxsize = 0;
+    last = min(job->lo + (k + 1)*MRKBLK, job->hi);
+    for (mm = job->lo + k*MRKBLK; mm < last; mm++) {
+        size = mrk[mtst[mm]].nall*mrk[mtst[mm+1]].nall*mrk[mtst[mm+2]].nall;
+        if (size > maxsize)
+            maxsize = size;
+    }
+
+    /* one table for each cell, and one for the stratum */
+    ht = (struct HapTable *) allocMem((ncell + 1)*sizeof(struct HapTable));
+    for (c = 0; c <= ncell; c++)
+        ht_alloc(&ht[c], maxsize);
+    sht = &ht[ncell];
+
+    for (mm = job->lo + k*MRKBLK; mm < last; mm++) {
+        count_triple(mm, ht);
+        for (s = 0; s < NSTRAT; s++) {
+            if (!strata[s].n)
                 continue;
-            if (all1[i][m1] != -1) {
-                if (all1[i][m2] != -1) {
-                    if (all1[i][m3] != -1)
-                        hcnt3[all1[i][m1]][all1[i][m2]][all1[i][m3]]++;
+            for (c = 0; c < strata[s].ncell; c++) {
+                cht = &ht[strata[s].cells[c]];
+                for (i = 0; i < cht->nkey; i++)
+                    ht_add(sht, cht->key[i], cht->cnt[cht->key[i]]);
+            }
+            test_triple(&strata[s], mm, sht, &job->out[s*chunk + mm-job->lo]);
+            ht_clear(sht);
+        }
+        for (c = 0; c < ncell; c++)
+            ht_clear(&ht[c]);
+    }
+
+    for (c = 0; c <= ncell; c++)
+        ht_free(&ht[c]);
+    free(ht);
+}
+
+/*
+ *  Tally the 3-locus haplotypes of the triple (mm, mm+1, mm+2) of the
+ *  test list in each cell.
+ */
+
+void count_triple (int mm, struct HapTable *ht)
+{
+    int i, j, n2, n3;
+    int rank[3][MXALL];
+    struct HapTable *h;
+    uint8_t *g1[3], *g2[3];
+
+    for (i = 0; i < 3; i++) {
+        g1[i] = GM_ALL1(&geno, mtst[mm+i]);
+        g2[i] = GM_ALL2(&geno, mtst[mm+i]);
+        for (j = 0; j < mrk[mtst[mm+i]].nall; j++)
+            rank[i][mrk[mtst[mm+i]].all_sort[j]] = j;
+    }
+    n2 = mrk[mtst[mm+1]].nall;
+    n3 = mrk[mtst[mm+2]].nall;
+
+#define KEY(a, b, c)	((rank[0][a]*n2 + rank[1][b])*n3 + rank[2][c])
+
+    for (i = 0; i < nind; i++) {
+        h = &ht[cell[i]];
+        if (g1[0][i] != GM_MISSING) {
+            if (g1[1][i] != GM_MISSING) {
+                if (g1[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g1[0][i], g1[1][i], g1[2][i]), 1);
 #ifdef PHASE_UNKNOWN
-                    if (all2[i][m3] != -1)
-                        hcnt3[all1[i][m1]][all1[i][m2]][all2[i][m3]]++;
+                if (g2[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g1[0][i], g1[1][i], g2[2][i]), 1);
 #endif
-                }
+            }
 #ifdef PHASE_UNKNOWN
-                if (all2[i][m2] != -1) {
-                    if (all1[i][m3] != -1)
-                        hcnt3[all1[i][m1]][all2[i][m2]][all1[i][m3]]++;
-                    if (all2[i][m3] != -1)
-                        hcnt3[all1[i][m1]][all2[i][m2]][all2[i][m3]]++;
-                }
-#endif
+            if (g2[1][i] != GM_MISSING) {
+                if (g1[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g1[0][i], g2[1][i], g1[2][i]), 1);
+                if (g2[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g1[0][i], g2[1][i], g2[2][i]), 1);
             }
-            if (all2[i][m1] != -1) {
+#endif
+        }
+        if (g2[0][i] != GM_MISSING) {
 #ifdef PHASE_UNKNOWN
-                if (all1[i][m2] != -1) {
-                    if (all1[i][m3] != -1)
-                        hcnt3[all2[i][m1]][all1[i][m2]][all1[i][m3]]++;
-                    if (all2[i][m3] != -1)
-                        hcnt3[all2[i][m1]][all1[i][m2]][all2[i][m3]]++;
-                }
+            if (g1[1][i] != GM_MISSING) {
+                if (g1[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g2[0][i], g1[1][i], g1[2][i]), 1);
+                if (g2[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g2[0][i], g1[1][i], g2[2][i]), 1);
+            }
 #endif
-                if (all2[i][m2] != -1) {
+            if (g2[1][i] != GM_MISSING) {
 #ifdef PHASE_UNKNOWN
-                    if (all1[i][m3] != -1)
-                        hcnt3[all2[i][m1]][all2[i][m2]][all1[i][m3]]++;
+                if (g1[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g2[0][i], g2[1][i], g1[2][i]), 1);
 #endif
-                    if (all2[i][m3] != -1)
-                        hcnt3[all2[i][m1]][all2[i][m2]][all2[i][m3]]++;
-                }
-            }
-        }
-
-        nfrq = 0;
-        sum = 0;
-        for (i = 0; i < mrk[m1].nall; i++) {
-            for (j = 0; j < mrk[m2].nall; j++) {
-                for (k = 0; k < mrk[m3].nall; k++) {
-                    if (hcnt3[i][j][k]) {
-                        sum += hcnt3[i][j][k];
-                        nfrq++;
-                    }
-                }
+                if (g2[2][i] != GM_MISSING)
+                    ht_add(h, KEY(g2[0][i], g2[1][i], g2[2][i]), 1);
             }
         }
+    }
 
-        asum = 0;
-        for (ii = 0; nfrq && ii < mrk[m1].nall; ii++) {
-            i = mrk[m1].all_sort[ii];
-            for (jj = 0; nfrq && jj < mrk[m2].nall; jj++) {
-                j = mrk[m2].all_sort[jj];
-                for (kk = 0; nfrq && kk < mrk[m3].nall; kk++) {
-                    k = mrk[m3].all_sort[kk];
-                    if (hcnt3[i][j][k]) {
-                        nfrq--;
-                        if (nfrq) {
-                            sprintf(buf, "%8.6f", hcnt3[i][j][k]/sum);
-                            sscanf(buf, "%lf", &hfrq3[i][j][k]);
-                            asum += hfrq3[i][j][k];
-                        }
-                        else
-                            hfrq3[i][j][k] = 1 - asum;
-
-                        d3[i][j][k] = hfrq3[i][j][k]
-                                - tafreq[m1][i] * td2[m2][m3][j][k]
-                                - tafreq[m2][j] * td2[m1][m3][i][k]
-                                - tafreq[m3][k] * td2[m1][m2][i][j]
-                                - tafreq[m1][i] * tafreq[m2][j] * tafreq[m3][k];
-                        var = (tpi[m1][i] * tpi[m2][j] * tpi[m3][k]
-                               + 6 * td2[m1][m2][i][j]
-                                   * td2[m2][m3][j][k] * td2[m1][m3][i][k]
-                               + tpi[m1][i] *
-                                 (ttau[m2][j] * ttau[m3][k] * td2[m2][m3][j][k]
-                                  - pow(td2[m2][m3][j][k],2.))
-                               + tpi[m2][j] *
-                                 (ttau[m1][i] * ttau[m3][k] * td2[m1][m3][i][k]
-                                  - pow(td2[m1][m3][i][k],2.))
-                               + tpi[m3][k] *
-                                 (ttau[m1][i] * ttau[m2][j] * td2[m1][m2][i][j]
-                                  - pow(td2[m1][m2][i][j],2.))
-                               + d3[i][j][k] *
-                                 (ttau[m1][i] * ttau[m2][j] * ttau[m3][k]
-                                  - 2 * ttau[m1][i] * td2[m2][m3][j][k]
-                                  - 2 * ttau[m2][j] * td2[m1][m3][i][k]
-                                  - 2 * ttau[m3][k] * td2[m1][m2][i][j]
-                                  - d3[i][j][k]))/n;
-                        chi = pow(d3[i][j][k],2.)/var;
-if (var < 0) {
-printf("ta1i=%g ta2j=%g ta3k=%g\n", tafreq[m1][i], tafreq[m2][j], tafreq[m3][k]);
-printf("tp1i=%g tp2j=%g tp3k=%g\n", tpi[m1][i], tpi[m2][j], tpi[m3][k]);
-printf("tt1i=%g tt2j=%g tt3k=%g\n", ttau[m1][i], ttau[m2][j], ttau[m3][k]);
-printf("td23jk=%g td13ik=%g td12ij=%g\n", td2[m2][m3][j][k], td2[m1][m3][i][k], td2[m1][m2][i][j]);
-printf("n=%d d3=%g hf=%g var=%g chi=%g\n", n, d3[i][j][k], hfrq3[i][j][k], var, chi);
-fflush(stdout);
+#undef KEY
 }
-                        if (chi == 0) {
-                            fprintf(fp, "%s%-5s %-5s %-5s  %8.6f %9.6f %9.6f %.8g\n",
-                                    indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
-                                    mrk[m3].alleles[k], hfrq3[i][j][k],
-                                    d3[i][j][k], chi, 1.);
-                        }
-                        else {
-                            fprintf(fp, "%s%-5s %-5s %-5s  %8.6f %9.6f %9.6f %.8g\n",
-                                    indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
-                                    mrk[m3].alleles[k], hfrq3[i][j][k],
-                                    d3[i][j][k], chi, 1 - pchis_(&chi, &df));
-                        }
-                    }
-                }
-            }
+
+/*
+ *  Test the triple (mm, mm+1, mm+2) of the test list for 3-locus LD in a
+ *  stratum, given its haplotype counts in the stratum, and append the
+ *  results to out.
+ */
+
+void test_triple (struct Stratum *st, int mm, struct HapTable *ht,
+                  struct Text *out)
+{
+    int i, j, k, key, nfrq, n = st->n;
+    int m1, m2, m3;
+    int *cnt = ht->cnt;
+    double hfrq3, d3, d12, d13, d23;
+    double **tafreq = st->tafreq, **tpi = st->tpi, **ttau = st->ttau;
+    double sum, asum;
+    double chi, var;
+    char buf[32], *indent = st->indent;
+
+    m1 = mtst[mm];
+    m2 = mtst[mm+1];
+    m3 = mtst[mm+2];
+
+    text_printf(out, "\n%sMARKERS: %s %s %s\n", indent, mrk[m1].name,
+                mrk[m2].name, mrk[m3].name);
+    text_printf(out,
+            "%sALL1  ALL2  ALL3    H3FREQ      D3       CHI2     1-PVAL\n",
+            indent);
+
+    qsort(ht->key, ht->nkey, sizeof(int), cmp_key);
+
+    sum = 0;
+    for (key = 0; key < ht->nkey; key++)
+        sum += cnt[ht->key[key]];
+
+    asum = 0;
+    for (nfrq = ht->nkey, key = 0; key < ht->nkey; key++) {
+        i = ht->key[key]/(mrk[m2].nall*mrk[m3].nall);
+        j = ht->key[key]/mrk[m3].nall%mrk[m2].nall;
+        k = ht->key[key]%mrk[m3].nall;
+        i = mrk[m1].all_sort[i];
+        j = mrk[m2].all_sort[j];
+        k = mrk[m3].all_sort[k];
+
+        d12 = dt_value(st->td2, mm, 1, i, j);
+        d13 = dt_value(st->td2, mm, 2, i, k);
+        d23 = dt_value(st->td2, mm + 1, 1, j, k);
+        nfrq--;
+        if (nfrq) {
+            sprintf(buf, "%8.6f", cnt[ht->key[key]]/sum);
+            sscanf(buf, "%lf", &hfrq3);
+            asum += hfrq3;
+        }
+        else
+            hfrq3 = 1 - asum;
+
+        d3 = hfrq3
+                - tafreq[m1][i] * d23
+                - tafreq[m2][j] * d13
+                - tafreq[m3][k] * d12
+                - tafreq[m1][i] * tafreq[m2][j] * tafreq[m3][k];
+        var = (tpi[m1][i] * tpi[m2][j] * tpi[m3][k]
+               + 6 * d12 * d23 * d13
+               + tpi[m1][i] * (ttau[m2][j] * ttau[m3][k] * d23 - pow(d23,2.))
+               + tpi[m2][j] * (ttau[m1][i] * ttau[m3][k] * d13 - pow(d13,2.))
+               + tpi[m3][k] * (ttau[m1][i] * ttau[m2][j] * d12 - pow(d12,2.))
+               + d3 * (ttau[m1][i] * ttau[m2][j] * ttau[m3][k]
+                       - 2 * ttau[m1][i] * d23
+                       - 2 * ttau[m2][j] * d13
+                       - 2 * ttau[m3][k] * d12
+                       - d3))/n;
+        if (var <= 0) {
+            text_printf(out, "%s%-5s %-5s %-5s  %8.6f %9.6f   ******    ******\n",
+                        indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
+                        mrk[m3].alleles[k], hfrq3, d3);
+            continue;
         }
+        chi = pow(d3,2.)/var;
+        text_printf(out, "%s%-5s %-5s %-5s  %8.6f %9.6f %9.6f %.8g\n",
+                    indent, mrk[m1].alleles[i], mrk[m2].alleles[j],
+                    mrk[m3].alleles[k], hfrq3, d3, chi, chi_p(chi, 1));
     }
 }
 
-void setup_storage(double *****d2_ptr, double ***pi_ptr, double ***tau_ptr,
-                   double **freq)
+void ht_alloc (struct HapTable *ht, int size)
+{
+    int i;
+
+    ht->cnt = (int *) allocMem((size + 1)*sizeof(int));
+    ht->key = (int *) allocMem((size + 1)*sizeof(int));
+    ht->nkey = 0;
+    for (i = 0; i < size; i++)
+        ht->cnt[i] = 0;
+}
+
+void ht_free (struct HapTable *ht)
+{
+    free(ht->cnt);
+    free(ht->key);
+}
+
+void ht_add (struct HapTable *ht, int key, int n)
+{
+    if (!ht->cnt[key])
+        ht->key[ht->nkey++] = key;
+    ht->cnt[key] += n;
+}
+
+void ht_clear (struct HapTable *ht)
 {
-    int i, j, k;
-    double **pi, **tau, ****d2;
+    int i;
+
+    for (i = 0; i < ht->nkey; i++)
+        ht->cnt[ht->key[i]] = 0;
+    ht->nkey = 0;
+}
+
+int cmp_key (const void *a, const void *b)
+{
+    return *(const int *) a - *(const int *) b;
+}
 
-    d2 = (double ****) allocMem(nmrk*sizeof(double ***));
-    pi = (double **) allocMem(nmrk*sizeof(double *));
-    tau = (double **) allocMem(nmrk*sizeof(double *));
+void setup_storage(struct DTable *d2, double ***pi_ptr, double ***tau_ptr,
+                   double **freq)
+{
+    int i, j;
+    size_t k, n;
+    double **pi, **tau;
+
+    d2->wsize = triple ? 2 : 0;
+    d2->nrow = chunk + 1;
+    d2->d = (double **) allocMem(((size_t) d2->nrow*d2->wsize + 1)
+                                 *sizeof(double *));
+    for (k = 0; k < (size_t) d2->nrow*d2->wsize; k++)
+        d2->d[k] = 0;
+
+    /* one block each, of a row of nall values per marker */
+    for (n = 1, i = 0; i < nmrk; i++)
+        n += mrk[i].nall;
+    pi = (double **) allocMem((nmrk + 1)*sizeof(double *));
+    tau = (double **) allocMem((nmrk + 1)*sizeof(double *));
+    pi[0] = (double *) allocMem(n*sizeof(double));
+    tau[0] = (double *) allocMem(n*sizeof(double));
     for (i = 0; i < nmrk; i++) {
-        d2[i] = (double ***) allocMem(nmrk*sizeof(double **));
-        for (j = 0; j < nmrk; j++) {
-            d2[i][j] = (double **) allocMem(MXALL*sizeof(double *));
-            for (k = 0; k < MXALL; k++) {
-                d2[i][j][k] = (double *) allocMem(MXALL*sizeof(double));
-            }
+        if (i > 0) {
+            pi[i] = pi[i-1] + mrk[i-1].nall;
+            tau[i] = tau[i-1] + mrk[i-1].nall;
         }
-        pi[i] = (double *) allocMem(MXALL*sizeof(double));
-        tau[i] = (double *) allocMem(MXALL*sizeof(double));
         for (j = 0; j < mrk[i].nall; j++) {
             pi[i][j] = freq[i][j] * (1 - freq[i][j]);
             tau[i][j] = 1 - 2*freq[i][j];
         }
     }
 
-    *d2_ptr = d2;
     *pi_ptr = pi;
     *tau_ptr = tau;
 }
 
+/*
+ *  Return the D table of pair (mm, mm+k) of the test list, allocating
+ *  it, with all values zero, if the pair has not been tested yet, or 0
+ *  if the pair's D values are not kept.
+ */
+
+double *
+dt_pair (struct DTable *t, int mm, int k)
+{
+    int i, n;
+    double **pd;
+
+    if (k > t->wsize)
+        return 0;
+
+    pd = &DT_PAIR(t, mm, k);
+    if (!*pd) {
+        n = mrk[mtst[mm]].nall*mrk[mtst[mm+k]].nall;
+        *pd = (double *) allocMem((n + 1)*sizeof(double));
+        for (i = 0; i < n; i++)
+            (*pd)[i] = 0;
+    }
+
+    return *pd;
+}
+
+/*
+ *  D for alleles i and j of pair (mm, mm+k), or 0 if the pair is
+ *  outside the window or has not been tested.
+ */
+
+double
+dt_value (struct DTable *t, int mm, int k, int i, int j)
+{
+    double *pd;
+
+    if (k > t->wsize || mm + k >= ntst || !(pd = DT_PAIR(t, mm, k)))
+        return 0;
+
+    return pd[i*mrk[mtst[mm+k]].nall + j];
+}
+
+/*
+ *  Free the D tables of the pairs of markers lo..hi-1 of the test list.
+ */
+
+void
+dt_release (struct DTable *t, int lo, int hi)
+{
+    int mm, k;
+    double **pd;
+
+    for (mm = lo; mm < hi; mm++) {
+        for (k = 1; k <= t->wsize; k++) {
+            pd = &DT_PAIR(t, mm, k);
+            free(*pd);
+            *pd = 0;
+        }
+    }
+}
+
+void
+dt_free (struct DTable *t)
+{
+    size_t i;
+
+    for (i = 0; i < (size_t) t->nrow*t->wsize; i++) {
+        if (t->d[i])
+            free(t->d[i]);
+    }
+    free(t->d);
+    t->d = 0;
+}
+
+/*
+ *  Free the D tables of all strata, once their tests have been written.
+ */
+
+void
+free_storage (void)
+{
+    int i;
+
+    dt_free(&d2);
+    dt_free(&d2u);
+    dt_free(&d2a);
+    for (i = 0; i < npop; i++) {
+        dt_free(&d2p[i]);
+        dt_free(&d2pu[i]);
+        dt_free(&d2pa[i]);
+    }
+}
+
+/*
+ *  Read allele frequencies from a binary count store. The strata and
+ *  alleles are visited in the order in which they occur in the allele
+ *  frequencies file, so that alleles and populations are numbered just
+ *  as when reading that file.
+ */
+
+void read_store (char *file)
+{
+    int i, k, s, n, nall, iaff, ipop, iall;
+    int *saff, *spop;
+    int32_t *cnt;
+    double *frq;
+    struct CntStore cs;
+
+    cs_open(file, &cs);
+
+    /* strata in file order: U/-, U/pops, A/-, A/pops, -/pops, -/- */
+    saff = (int *) allocMem(CS_NSTRATA(cs.npop)*sizeof(int));
+    spop = (int *) allocMem(CS_NSTRATA(cs.npop)*sizeof(int));
+    n = 0;
+    for (iaff = 1; iaff <= 2; iaff++) {
+        for (ipop = -1; ipop < cs.npop; ipop++) {
+            saff[n] = iaff;
+            spop[n++] = ipop;
+        }
+    }
+    for (ipop = 0; ipop < cs.npop; ipop++) {
+        saff[n] = 0;
+        spop[n++] = ipop;
+    }
+    saff[n] = 0;
+    spop[n++] = -1;
+
+    nmrk = cs.nmrk;
+    alloc_freqs();
+
+    for (i = 0; i < nmrk; i++) {
+        mrk[i].name = cs_marker(&cs, i);
+        mrk[i].nall = 0;
+        nall = cs_nall(&cs, i);
+        frq = (double *) allocMem((nall + 1)*sizeof(double));
+
+        for (s = 0; s < n; s++) {
+            iaff = saff[s];
+            cnt = cs_counts(&cs, i, iaff, spop[s]);
+            if (!cs_freqs(cnt, nall, frq))
+                continue;
+
+            ipop = -1;
+            if (spop[s] != -1 &&
+                    (ipop = get_ndx(cs_pop(&cs, spop[s]), pops, npop)) == -1) {
+                if (npop == MXPOP) {
+                    fprintf(stderr, "too many populations, MXPOP = %d\n",
+                            MXPOP);
+                    exit(1);
+                }
+                ipop = add_name(cs_pop(&cs, spop[s]), &pops, &npop);
+            }
+
+            for (k = 0; k < nall; k++) {
+                if (!cnt[k])
+                    continue;
+                if ((iall = get_ndx(cs_allele(&cs, i, k), mrk[i].alleles,
+                                    mrk[i].nall)) == -1) {
+                    if (mrk[i].nall == MXALL) {
+                        fprintf(stderr,
+                                "marker %s has too many alleles, MXALL = %d\n",
+                                mrk[i].name, MXALL);
+                        exit(1);
+                    }
+                    iall = add_allele(cs_allele(&cs, i, k), &mrk[i].alleles,
+                                      &mrk[i].nall);
+                }
+                sfreq[iaff][ipop+1][iall] = frq[k];
+            }
+        }
+
+        free(frq);
+        save_freqs(i);
+    }
+
+    /* populations first seen after a marker have frequency zero there */
+    for (i = 0; i < nmrk; i++)
+        save_freqs(i);
+
+    for (i = 0; i < nmrk; i++) {
+        mrk[i].all_sort = (int *) allocMem(mrk[i].nall*sizeof(int));
+        sort_names(mrk[i].alleles, mrk[i].nall, mrk[i].all_sort);
+    }
+
+    free(saff);
+    free(spop);
+}
+
+/*
+ *  Allocate the marker list and allele frequency tables for nmrk markers.
+ *  The row of each marker is allocated by save_freqs, once its alleles
+ *  are known.
+ */
+
+void alloc_freqs (void)
+{
+    int imrk, iaff, ipop;
+
+    mrk = (struct Marker *) allocMem(nmrk*sizeof(struct Marker));
+
+    afreq = (double **) allocMem(nmrk*sizeof(double *));
+    afrequ = (double **) allocMem(nmrk*sizeof(double *));
+    afreqa = (double **) allocMem(nmrk*sizeof(double *));
+    afreqp = (double ***) allocMem(MXPOP*sizeof(double **));
+    afreqpu = (double ***) allocMem(MXPOP*sizeof(double **));
+    afreqpa = (double ***) allocMem(MXPOP*sizeof(double **));
+    for (ipop = 0; ipop < MXPOP; ipop++) {
+        afreqp[ipop] = (double **) allocMem(nmrk*sizeof(double *));
+        afreqpu[ipop] = (double **) allocMem(nmrk*sizeof(double *));
+        afreqpa[ipop] = (double **) allocMem(nmrk*sizeof(double *));
+    }
+
+    for (iaff = 0; iaff < 3; iaff++) {
+        for (ipop = -1; ipop < MXPOP; ipop++) {
+            for (imrk = 0; imrk < nmrk; imrk++)
+                freq_table(iaff, ipop)[imrk] = 0;
+        }
+    }
+}
+
+/*
+ *  The allele frequency table for affection status iaff (0 for all,
+ *  1 for unaffecteds, 2 for affecteds) and population ipop (-1 for all).
+ */
+
+double **freq_table (int iaff, int ipop)
+{
+    if (ipop == -1)
+        return iaff == 0 ? afreq : iaff == 1 ? afrequ : afreqa;
+    return iaff == 0 ? afreqp[ipop] : iaff == 1 ? afreqpu[ipop] : afreqpa[ipop];
+}
+
+/*
+ *  Move the frequencies of marker imrk, gathered in sfreq, to rows of its
+ *  number of alleles in the tables of each stratum that has no row for it
+ *  yet, and clear sfreq for the next marker. An allele not seen in a
+ *  stratum has frequency zero there.
+ */
+
+void save_freqs (int imrk)
+{
+    int iaff, ipop, iall, nall = mrk[imrk].nall;
+    double *row;
+
+    for (iaff = 0; iaff < 3; iaff++) {
+        for (ipop = -1; ipop < npop; ipop++) {
+            if (freq_table(iaff, ipop)[imrk])
+                continue;
+            row = (double *) allocMem((nall + 1)*sizeof(double));
+            for (iall = 0; iall < nall; iall++) {
+                row[iall] = sfreq[iaff][ipop+1][iall];
+                sfreq[iaff][ipop+1][iall] = 0;
+            }
+            freq_table(iaff, ipop)[imrk] = row;
+        }
+    }
+}
+
+/*
+ *  The number of the marker with the given name, or -1 if there is no
+ *  such marker. The names are looked up in a sorted index, built on the
+ *  first call; of markers with the same name, the first is returned.
+ */
+
+int *mndx;
+
+int
+find_marker (char *name)
+{
+    int lo, hi, mid, i;
+
+    if (!mndx) {
+        mndx = (int *) allocMem(nmrk*sizeof(int));
+        for (i = 0; i < nmrk; i++)
+            mndx[i] = i;
+        qsort(mndx, nmrk, sizeof(int), cmp_mrkname);
+    }
+
+    lo = 0;
+    hi = nmrk;
+    while (lo < hi) {
+        mid = (lo + hi)/2;
+        if (strcmp(mrk[mndx[mid]].name, name) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo < nmrk && !strcmp(mrk[mndx[lo]].name, name) ? mndx[lo] : -1;
+}
+
+int
+cmp_mrkname (const void *a, const void *b)
+{
+    int c = strcmp(mrk[*(int *) a].name, mrk[*(int *) b].name);
+
+    return c ? c : *(int *) a - *(int *) b;
+}
+
+/*
+ *  Read one line of arbitrary length into a buffer which is grown as
+ *  needed. Returns the length of the line, or 0 at end of file.
+ */
+
+int
+read_record (FILE *fp, char **buf, int *size)
+{
+    int len;
+
+    if (!*size) {
+        *size = 10000;
+        *buf = (char *) allocMem(*size);
+    }
+
+    len = 0;
+    while (fgets(*buf + len, *size - len, fp)) {
+        len += strlen(*buf + len);
+        if ((*buf)[len-1] == '\n')
+            break;
+        if (len == *size - 1) {
+            *size *= 2;
+            *buf = (char *) growMem(*buf, *size);
+        }
+    }
+
+    return len;
+}
+
 int
 get_ndx (char *str, char **array, int nelem)
 {
@@ -1097,6 +2962,9 @@ get_ndx (char *str, char **array, int nelem)
 int
 add_name (char *str, char ***array, int *nelem)
 {
+    int nblk;
+    char **p;
+
     if (!*nelem) {
         *array = (char **) malloc(ALLBLK*sizeof(char *));
         if (!*array) {
@@ -1104,12 +2972,14 @@ add_name (char *str, char ***array, int *nelem)
             exit(1);
         }
     }
-    else if (!(*nelem)%ALLBLK) {
-        *array = (char **) realloc(*array, ALLBLK*sizeof(char *));
-        if (!*array) {
+    else if (!(*nelem%ALLBLK)) {
+        nblk = (*nelem)/ALLBLK + 1;
+        p = (char **) realloc(*array, nblk*ALLBLK*sizeof(char *));
+        if (!p) {
             fprintf(stderr, "not enough memory\n");
             exit(1);
         }
+        *array = p;
     }
 
     (*array)[*nelem] = (char *) allocMem(strlen(str)+1);
@@ -1119,6 +2989,27 @@ add_name (char *str, char ***array, int *nelem)
     return *nelem - 1;
 }
 
+/*
+ *  Like add_name, for the allele names of a marker. Most markers have
+ *  few alleles, so the array starts with room for 2 names and is doubled
+ *  as needed, rather than grown ALLBLK at a time.
+ */
+
+int
+add_allele (char *str, char ***array, int *nelem)
+{
+    if (!*nelem)
+        *array = (char **) allocMem(2*sizeof(char *));
+    else if (*nelem >= 2 && !(*nelem & (*nelem - 1)))
+        *array = (char **) growMem(*array, 2*(*nelem)*sizeof(char *));
+
+    (*array)[*nelem] = (char *) allocMem(strlen(str)+1);
+    strcpy((*array)[*nelem], str);
+    (*nelem)++;
+
+    return *nelem - 1;
+}
+
 void
 sort_names (char **array, int nelem, int *order)
 {
@@ -1157,3 +3048,14 @@ void
     }
     return ptr;
 }
+
+void
+*growMem (void *ptr, size_t nbytes)
+{
+    ptr = (void *) realloc(ptr, nbytes);
+    if (!ptr) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+    return ptr;
+}
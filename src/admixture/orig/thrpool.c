@@ -0,0 +1,91 @@
+/*
+ * thrpool.c
+ *
+ *
+ * Run a set of independent tasks on a pool of threads. Tasks are
+ * numbered 0 to ntask-1 and are handed out in that order to whichever
+ * thread is free, so a task must write its results only to storage
+ * which belongs to that task. With one thread, or one task, the tasks
+ * are simply run in order by the calling thread.
+ *
+ *     run_tasks(nthread, ntask, task, arg)
+ *
+ *        nthread  number of threads
+ *        ntask    number of tasks
+ *        task     function called as task(i, arg) for task i
+ *        arg      argument passed to every task
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "thrpool.h"
+
+struct Pool {
+    int ntask;			/* number of tasks		*/
+    int next;			/* next task to be run		*/
+    void (*task)(int, void *);	/* task function		*/
+    void *arg;			/* task argument		*/
+    pthread_mutex_t lock;	/* protects next		*/
+} ;
+
+static void *
+worker (void *ptr)
+{
+    int i;
+    struct Pool *pool = (struct Pool *) ptr;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        i = pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+        if (i >= pool->ntask)
+            break;
+        pool->task(i, pool->arg);
+    }
+
+    return 0;
+}
+
+void
+run_tasks (int nthread, int ntask, void (*task)(int, void *), void *arg)
+{
+    int i;
+    struct Pool pool;
+    pthread_t *tid;
+
+    if (nthread > ntask)
+        nthread = ntask;
+
+    if (nthread <= 1) {
+        for (i = 0; i < ntask; i++)
+            task(i, arg);
+        return;
+    }
+
+    pool.ntask = ntask;
+    pool.next = 0;
+    pool.task = task;
+    pool.arg = arg;
+    pthread_mutex_init(&pool.lock, 0);
+
+    tid = (pthread_t *) malloc(nthread*sizeof(pthread_t));
+    if (!tid) {
+        fprintf(stderr, "not enough memory\n");
+        exit(1);
+    }
+
+    for (i = 0; i < nthread; i++) {
+        if (pthread_create(&tid[i], 0, worker, &pool)) {
+            fprintf(stderr, "cannot create thread\n");
+            exit(1);
+        }
+    }
+    for (i = 0; i < nthread; i++)
+        pthread_join(tid[i], 0);
+
+    pthread_mutex_destroy(&pool.lock);
+    free(tid);
+}
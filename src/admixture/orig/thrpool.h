@@ -0,0 +1,8 @@
+/*
+ * thrpool.h
+ *
+ * Run a set of independent tasks on a pool of threads.
+ *
+ */
+
+void run_tasks (int nthread, int ntask, void (*task)(int, void *), void *arg);